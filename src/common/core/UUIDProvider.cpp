@@ -1,6 +1,91 @@
 #include "common/core/UUIDProvider.hpp"
 
+#include <atomic>
+#include <mutex>
+
 s64 UUIDProvider::s_workerId = 1;
 s64 UUIDProvider::s_datacenterId = 1;
 s64 UUIDProvider::s_twepoch = 687888001020L;
-snowflake<> UUIDProvider::s_snowFlake;
\ No newline at end of file
+
+namespace {
+
+struct alignas(64) Shard {
+    snowflake<> generator;
+};
+
+// shard 0 is the fallback and never leased
+constexpr u32 FALLBACK_SHARD = 0;
+
+static_assert(UUIDProvider::SHARD_COUNT < 32, "free shards are tracked in a u32 mask");
+
+Shard s_shards[UUIDProvider::SHARD_COUNT];
+snowflake<std::mutex> s_fallback;
+std::atomic<u32> s_freeShards = ((1u << UUIDProvider::SHARD_COUNT) - 1) & ~(1u << FALLBACK_SHARD);
+
+struct ShardLease {
+    ShardLease()
+    {
+        u32 free = s_freeShards.load(std::memory_order_relaxed);
+        while (free != 0) {
+            u32 bit = free & -free;
+            // acquire pairs with the release below, the generator state
+            // left by the previous owner is visible before we continue it
+            if (s_freeShards.compare_exchange_weak(free, free & ~bit, std::memory_order_acquire, std::memory_order_relaxed)) {
+                index = static_cast<u32>(__builtin_ctz(bit));
+                return;
+            }
+        }
+    }
+
+    ~ShardLease()
+    {
+        if (index != FALLBACK_SHARD) {
+            s_freeShards.fetch_or(1u << index, std::memory_order_release);
+        }
+    }
+
+    u32 index = FALLBACK_SHARD;
+};
+
+u32 currentShard()
+{
+    thread_local ShardLease lease;
+    return lease.index;
+}
+
+} // namespace
+
+void UUIDProvider::init(s64 workerId, s64 datacenterId, s64 twepoch)
+{
+    s_workerId = workerId;
+    s_datacenterId = datacenterId;
+    s_twepoch = twepoch;
+
+    for (u32 i = 0; i < SHARD_COUNT; ++i) {
+        s_shards[i].generator.init(s_workerId, s_datacenterId, s_twepoch, i, SHARD_BITS);
+    }
+    s_fallback.init(s_workerId, s_datacenterId, s_twepoch, FALLBACK_SHARD, SHARD_BITS);
+}
+
+s64 UUIDProvider::nextUUID()
+{
+    u32 shard = currentShard();
+    if (shard == FALLBACK_SHARD) {
+        return s_fallback.nextid();
+    }
+    return s_shards[shard].generator.nextid();
+}
+
+snowflake_range UUIDProvider::reserve(u32 count)
+{
+    u32 shard = currentShard();
+    if (shard == FALLBACK_SHARD) {
+        return s_fallback.reserve(count);
+    }
+    return s_shards[shard].generator.reserve(count);
+}
+
+u32 UUIDProvider::maxReserve()
+{
+    return static_cast<u32>(s_fallback.max_reserve());
+}
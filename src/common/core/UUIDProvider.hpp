@@ -4,26 +4,38 @@
 #include "common/utils/IntTypes.hpp"
 #include "common/utils/SnowFlake.hpp"
 
+/*
+ * Each thread leases its own snowflake shard on first use: a fixed slice of
+ * the sequence bits, so generation takes no lock and shards never collide.
+ * Threads beyond SHARD_COUNT - 1 share a mutex-guarded fallback shard.
+ * Ids are increasing per thread, only unique across threads. A shard has
+ * 256 ids per millisecond; a thread asking for more borrows the following
+ * milliseconds and never waits, so I/O threads can draw ids. The sequence
+ * field caps a worker id at 4096 ids per millisecond however it is split,
+ * more than that needs more worker ids.
+ */
 class UUIDProvider {
 public:
-    static void init(s64 workerId, s64 datacenterId, s64 twepoch)
-    {
-        s_workerId = workerId;
-        s_datacenterId = datacenterId;
-        s_twepoch = twepoch;
-        s_snowFlake.init(s_workerId, s_datacenterId, s_twepoch);
-    }
+    static constexpr s64 SHARD_BITS = 4;
+    static constexpr u32 SHARD_COUNT = 1u << SHARD_BITS;
 
-    static s64 nextUUID()
-    {
-        return s_snowFlake.nextid();
-    }
+    // must run before any thread asks for an id
+    static void init(s64 workerId, s64 datacenterId, s64 twepoch);
+
+    static s64 nextUUID();
+
+    // up to count ids from the calling thread's shard in a single step, for
+    // spawning many entities at once. Never waits: a call returns at most
+    // maxReserve() ids and fewer, or none, when the shard has already
+    // borrowed ahead, so larger counts loop and retry once the range is empty.
+    static snowflake_range reserve(u32 count);
+    // 1280 with 4 shard bits, five milliseconds of a shard
+    static u32 maxReserve();
 
 private:
     static s64 s_workerId;
     static s64 s_datacenterId;
     static s64 s_twepoch;
-    static snowflake<> s_snowFlake;
 };
 
-#endif /* UUIDPROVIDER_HPP_ */
\ No newline at end of file
+#endif /* UUIDPROVIDER_HPP_ */
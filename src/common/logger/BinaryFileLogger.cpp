@@ -0,0 +1,179 @@
+#include "common/logger/BinaryFileLogger.hpp"
+
+#include <cstring>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "common/logger/BinaryLog.hpp"
+
+namespace {
+
+// the file grows and is remapped in steps of this size
+constexpr std::size_t MAP_WINDOW = 16 * 1024 * 1024;
+
+} // namespace
+
+BinaryFileLogger::BinaryFileLogger(const std::string& filename, std::string_view sourceName, std::unique_ptr<LogRotator> rotator)
+    : m_sourceName(sourceName)
+    , m_rotator(std::move(rotator))
+{
+    open(filename);
+}
+
+BinaryFileLogger::~BinaryFileLogger()
+{
+    close();
+}
+
+void BinaryFileLogger::flush()
+{
+    if (m_rotator && m_fd >= 0 && m_rotator->shouldRotate(m_size)) {
+        close();
+        open(m_rotator->rotate().string());
+    }
+}
+
+void BinaryFileLogger::open(const std::string& filename)
+{
+    m_fd = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (m_fd < 0) {
+        std::cerr << "Can't open log file: '" << filename << "'" << std::endl;
+        m_failed = true;
+        return;
+    }
+    m_failed = false;
+
+    // every segment is readable on its own, formats are written again
+    m_formatWritten.clear();
+
+    m_record.clear();
+    m_record.append(binlog::MAGIC, sizeof(binlog::MAGIC));
+    binlog::putRaw<u64>(m_record, binlog::wallNow());
+    binlog::putRaw<u64>(m_record, binlog::monotonicNow());
+    binlog::putRaw<u16>(m_record, static_cast<u16>(m_sourceName.size()));
+    m_record.append(m_sourceName);
+    write(m_record);
+}
+
+void BinaryFileLogger::close()
+{
+    if (m_map) {
+        ::munmap(m_map, m_mapSize);
+        m_map = nullptr;
+    }
+    if (m_fd >= 0) {
+        // drop the unused tail of the last window
+        if (::ftruncate(m_fd, m_size) != 0) {
+            std::cerr << "Binary log: failed to trim the log file" << std::endl;
+        }
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    m_size = 0;
+    m_mapOffset = 0;
+    m_mapSize = 0;
+}
+
+void BinaryFileLogger::print(const Log& log)
+{
+    if (m_failed) {
+        return;
+    }
+
+    u32 formatId = log.formatId() != 0 ? log.formatId() : textFormatId(log);
+    if (formatId >= m_formatWritten.size() || !m_formatWritten[formatId]) {
+        writeFormat(formatId);
+    }
+
+    m_record.clear();
+    m_record.push_back(static_cast<char>(binlog::RecordKind::Event));
+    binlog::putRaw<u32>(m_record, formatId);
+    binlog::putRaw<u64>(m_record, log.timestamp() != 0 ? log.timestamp() : binlog::monotonicNow());
+    if (log.formatId() != 0) {
+        binlog::putString(m_record, log.message());
+    } else {
+        binlog::putString(m_record, binlog::encodeArgs(log.message()));
+    }
+    write(m_record);
+}
+
+u32 BinaryFileLogger::textFormatId(const Log& log)
+{
+    auto key = std::make_pair(log.file(), log.line());
+    auto it = m_textFormats.find(key);
+    if (it != m_textFormats.end()) {
+        return it->second;
+    }
+
+    u32 id = binlog::registerFormat(log.level(), log.file(), log.line(), "{}");
+    m_textFormats.emplace(key, id);
+    return id;
+}
+
+void BinaryFileLogger::writeFormat(u32 id)
+{
+    auto format = binlog::getFormat(id);
+
+    m_record.clear();
+    m_record.push_back(static_cast<char>(binlog::RecordKind::Format));
+    binlog::putRaw<u32>(m_record, id);
+    binlog::putRaw<u8>(m_record, format.level);
+    binlog::putRaw<u32>(m_record, static_cast<u32>(format.line));
+    std::string_view file(format.file ? format.file : "");
+    binlog::putRaw<u16>(m_record, static_cast<u16>(file.size()));
+    m_record.append(file);
+    binlog::putString(m_record, format.format ? format.format : "");
+    write(m_record);
+
+    if (id >= m_formatWritten.size()) {
+        m_formatWritten.resize(id + 1);
+    }
+    m_formatWritten[id] = true;
+}
+
+void BinaryFileLogger::write(std::string_view record)
+{
+    if (!reserve(record.size())) {
+        return;
+    }
+    std::memcpy(m_map + (m_size - m_mapOffset), record.data(), record.size());
+    m_size += record.size();
+}
+
+bool BinaryFileLogger::reserve(std::size_t bytes)
+{
+    if (m_map && m_size + bytes <= m_mapOffset + m_mapSize) {
+        return true;
+    }
+    if (m_map) {
+        ::munmap(m_map, m_mapSize);
+        m_map = nullptr;
+    }
+
+    // the new window starts at the page holding the write position, so a
+    // record never straddles two mappings
+    const u64 pageSize = ::sysconf(_SC_PAGESIZE);
+    u64 offset = m_size & ~(pageSize - 1);
+    std::size_t size = MAP_WINDOW;
+    while (offset + size < m_size + bytes) {
+        size += MAP_WINDOW;
+    }
+
+    void* map = MAP_FAILED;
+    if (::ftruncate(m_fd, offset + size) == 0) {
+        map = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, offset);
+    }
+    if (map == MAP_FAILED) {
+        std::cerr << "Binary log: failed to extend the log file, logging stopped" << std::endl;
+        m_failed = true;
+        return false;
+    }
+
+    m_map = static_cast<char*>(map);
+    m_mapOffset = offset;
+    m_mapSize = size;
+    return true;
+}
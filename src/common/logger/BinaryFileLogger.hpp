@@ -0,0 +1,67 @@
+#ifndef BINARYFILELOGGER_HPP_
+#define BINARYFILELOGGER_HPP_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/logger/Log.hpp"
+#include "common/logger/LogRotator.hpp"
+#include "common/logger/Logger.hpp"
+
+/*
+ * Writes records in the binary log format (see BinaryLog.hpp) into a
+ * memory-mapped file. Formats are written the first time they are used;
+ * after that a record is its format id, a raw timestamp and the encoded
+ * arguments. Plain text records get a "{}" format per call site.
+ * Only the logger thread touches it, so nothing here is synchronized.
+ */
+class BinaryFileLogger : public Logger {
+public:
+    BinaryFileLogger(const std::string& filename, std::string_view sourceName, std::unique_ptr<LogRotator> rotator = nullptr);
+    ~BinaryFileLogger();
+
+    BinaryFileLogger(const BinaryFileLogger&) = delete;
+    BinaryFileLogger& operator=(const BinaryFileLogger&) = delete;
+
+    void print(const Log& log);
+    // dirty pages are written back by the kernel, even if the process dies;
+    // only checks whether a new segment is due
+    void flush();
+
+    // there is no free-form text in a binary log
+    BinaryFileLogger& operator<<(std::string_view) { return *this; }
+    BinaryFileLogger& operator<<(int) { return *this; }
+    BinaryFileLogger& operator<<(char) { return *this; }
+    BinaryFileLogger& operator<<(std::ostream& (*)(std::ostream&)) { return *this; }
+
+private:
+    void open(const std::string& filename);
+    void close();
+
+    u32 textFormatId(const Log& log);
+    void writeFormat(u32 id);
+    void write(std::string_view record);
+    bool reserve(std::size_t bytes);
+
+private:
+    std::string m_sourceName;
+    std::unique_ptr<LogRotator> m_rotator;
+
+    int m_fd = -1;
+    bool m_failed = false;
+
+    char* m_map = nullptr;
+    u64 m_mapOffset = 0;
+    std::size_t m_mapSize = 0;
+    u64 m_size = 0;
+
+    std::vector<bool> m_formatWritten;
+    std::map<std::pair<const char*, int>, u32> m_textFormats;
+    std::string m_record;
+};
+
+#endif /* BINARYFILELOGGER_HPP_ */
@@ -0,0 +1,134 @@
+#include "common/logger/BinaryLog.hpp"
+
+#include <charconv>
+#include <deque>
+#include <mutex>
+
+namespace binlog {
+
+namespace {
+
+std::mutex s_formatsMutex;
+// deque, entries never move once registered
+std::deque<FormatInfo> s_formats;
+
+template <typename T>
+bool takeRaw(std::string_view& in, T& value)
+{
+    if (in.size() < sizeof(T))
+        return false;
+    std::memcpy(&value, in.data(), sizeof(T));
+    in.remove_prefix(sizeof(T));
+    return true;
+}
+
+template <typename T>
+void appendNumber(std::string& out, T value)
+{
+    char digits[64];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    out.append(digits, result.ptr - digits);
+}
+
+// Appends the next argument as text, false once the input is exhausted or malformed.
+bool renderArg(std::string& out, std::string_view& in)
+{
+    u8 tag;
+    if (!takeRaw(in, tag))
+        return false;
+
+    switch (static_cast<ArgTag>(tag)) {
+    case ArgTag::Int: {
+        s64 value;
+        if (!takeRaw(in, value))
+            return false;
+        appendNumber(out, value);
+        return true;
+    }
+    case ArgTag::UInt: {
+        u64 value;
+        if (!takeRaw(in, value))
+            return false;
+        appendNumber(out, value);
+        return true;
+    }
+    case ArgTag::Float: {
+        double value;
+        if (!takeRaw(in, value))
+            return false;
+        appendNumber(out, value);
+        return true;
+    }
+    case ArgTag::String: {
+        u32 length;
+        if (!takeRaw(in, length) || in.size() < length)
+            return false;
+        out.append(in.substr(0, length));
+        in.remove_prefix(length);
+        return true;
+    }
+    case ArgTag::Bool: {
+        u8 value;
+        if (!takeRaw(in, value))
+            return false;
+        out.append(value ? "true" : "false");
+        return true;
+    }
+    case ArgTag::Char: {
+        char value;
+        if (!takeRaw(in, value))
+            return false;
+        out.push_back(value);
+        return true;
+    }
+    }
+    return false;
+}
+
+} // namespace
+
+u32 registerFormat(LogLevel level, const char* file, int line, const char* format)
+{
+    std::lock_guard<std::mutex> lock(s_formatsMutex);
+    s_formats.push_back({ level, file, line, format });
+    return static_cast<u32>(s_formats.size());
+}
+
+FormatInfo getFormat(u32 id)
+{
+    std::lock_guard<std::mutex> lock(s_formatsMutex);
+    if (id == 0 || id > s_formats.size())
+        return { LogLevel::None, "", 0, "" };
+    return s_formats[id - 1];
+}
+
+std::string render(std::string_view format, std::string_view args)
+{
+    std::string out;
+    out.reserve(format.size() + args.size());
+
+    std::size_t pos = 0;
+    while (pos < format.size()) {
+        auto placeholder = format.find("{}", pos);
+        if (placeholder == std::string_view::npos) {
+            out.append(format.substr(pos));
+            break;
+        }
+
+        out.append(format.substr(pos, placeholder - pos));
+        if (!renderArg(out, args))
+            out.append("{}");
+        pos = placeholder + 2;
+    }
+
+    // more arguments than placeholders, keep them rather than losing data
+    while (!args.empty()) {
+        out.push_back(' ');
+        if (!renderArg(out, args))
+            break;
+    }
+
+    return out;
+}
+
+} // namespace binlog
@@ -0,0 +1,123 @@
+#ifndef BINARYLOG_HPP_
+#define BINARYLOG_HPP_
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "common/logger/LoggerUtils.hpp"
+#include "common/utils/IntTypes.hpp"
+
+/*
+ * Binary log encoding shared by the server and the offline decoder.
+ *
+ * File layout, all integers little-endian:
+ *   header   "CSBLOG01", u64 wall clock ns, u64 monotonic ns (both taken at
+ *            open), u16 length + source name
+ *   FORMAT   u8 1, u32 id, u8 level, u32 line, u16 length + file,
+ *            u32 length + format string
+ *   EVENT    u8 2, u32 format id, u64 monotonic ns, u32 length + arguments
+ * A zero kind byte marks the end of the data. Arguments are a sequence of a
+ * tag byte followed by the raw value; strings carry a u32 length.
+ */
+namespace binlog {
+
+constexpr char MAGIC[8] = { 'C', 'S', 'B', 'L', 'O', 'G', '0', '1' };
+
+enum RecordKind : u8 {
+    End = 0,
+    Format = 1,
+    Event = 2,
+};
+
+enum class ArgTag : u8 {
+    Int = 1,
+    UInt = 2,
+    Float = 3,
+    String = 4,
+    Bool = 5,
+    Char = 6,
+};
+
+struct FormatInfo {
+    LogLevel level;
+    const char* file;
+    int line;
+    const char* format;
+};
+
+// Call sites register their format once, ids are dense and start at 1.
+u32 registerFormat(LogLevel level, const char* file, int line, const char* format);
+FormatInfo getFormat(u32 id);
+
+inline u64 monotonicNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline u64 wallNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+template <typename T>
+inline void putRaw(std::string& out, T value)
+{
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+inline void putString(std::string& out, std::string_view text)
+{
+    putRaw<u32>(out, static_cast<u32>(text.size()));
+    out.append(text);
+}
+
+template <typename T>
+void encodeArg(std::string& out, const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>) {
+        out.push_back(static_cast<char>(ArgTag::Bool));
+        out.push_back(value ? 1 : 0);
+    } else if constexpr (std::is_same_v<T, char>) {
+        out.push_back(static_cast<char>(ArgTag::Char));
+        out.push_back(value);
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        out.push_back(static_cast<char>(ArgTag::Int));
+        putRaw<s64>(out, value);
+    } else if constexpr (std::is_integral_v<T>) {
+        out.push_back(static_cast<char>(ArgTag::UInt));
+        putRaw<u64>(out, value);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        out.push_back(static_cast<char>(ArgTag::Float));
+        putRaw<double>(out, value);
+    } else if constexpr (std::is_enum_v<T>) {
+        encodeArg(out, static_cast<std::underlying_type_t<T>>(value));
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        out.push_back(static_cast<char>(ArgTag::String));
+        putString(out, std::string_view(value));
+    } else {
+        std::ostringstream stream;
+        stream << value;
+        encodeArg(out, stream.str());
+    }
+}
+
+template <typename... Args>
+std::string encodeArgs(const Args&... args)
+{
+    std::string out;
+    (encodeArg(out, args), ...);
+    return out;
+}
+
+// Substitutes the encoded arguments for the "{}" in format, in order.
+std::string render(std::string_view format, std::string_view args);
+
+} // namespace binlog
+
+#endif /* BINARYLOG_HPP_ */
@@ -13,7 +13,7 @@ class ConsoleLogger : public Logger, public std::enable_shared_from_this<Console
 public:
     ConsoleLogger() = default;
 
-    ConsoleLogger& operator<<(const std::string& str)
+    ConsoleLogger& operator<<(std::string_view str)
     {
         std::cout << str;
         return *this;
@@ -37,6 +37,11 @@ public:
         return *this;
     }
 
+    void flush()
+    {
+        std::cout.flush();
+    }
+
     void print(const Log& log)
     {
         auto _color = [&]() -> LoggerColor {
@@ -58,7 +63,7 @@ public:
             *this << LoggerUtils::textColor(LoggerColor::White, _color, false);
 
         char levels[4] = { 'D', 'I', 'W', 'E' };
-        *this << "[" << utils::getCurrentTime("%Y-%m-%d %H:%M:%S") << "] [" << levels[log.level()] << "] ";
+        *this << "[" << utils::formatTimestamp(std::chrono::system_clock::now()) << "] [" << levels[log.level()] << "] ";
 
         if (m_printFileAndLine)
             *this << log.file() << ":" << log.line() << ": ";
@@ -69,7 +74,9 @@ public:
         if (m_printWithColor)
             *this << LoggerUtils::textColorReset();
 
-        *this << " " << log.message() << std::endl;
+        *this << " ";
+        printMessage(log);
+        *this << '\n';
     }
 
 private:
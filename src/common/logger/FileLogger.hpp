@@ -6,12 +6,14 @@
 #include <memory>
 #include <string>
 
+#include "common/logger/LogRotator.hpp"
 #include "common/logger/Logger.hpp"
 #include "common/utils/Utils.hpp"
 
 class FileLogger : public Logger, public std::enable_shared_from_this<FileLogger> {
 public:
-    FileLogger(const std::string& filename)
+    FileLogger(const std::string& filename, std::unique_ptr<LogRotator> rotator = nullptr)
+        : m_rotator(std::move(rotator))
     {
         openFile(filename);
     }
@@ -23,7 +25,7 @@ public:
             std::cerr << "Can't open log file: '" << filename << "'" << std::endl;
     }
 
-    FileLogger& operator<<(const std::string& str)
+    FileLogger& operator<<(std::string_view str)
     {
         if (m_file.is_open())
             m_file << str;
@@ -51,10 +53,23 @@ public:
         return *this;
     }
 
+    void flush()
+    {
+        if (!m_file.is_open())
+            return;
+
+        m_file.flush();
+        // between batches, so a record is never split across segments
+        if (m_rotator && m_rotator->shouldRotate(m_file.tellp())) {
+            m_file.close();
+            openFile(m_rotator->rotate().string());
+        }
+    }
+
     void print(const Log& log)
     {
         char levels[4] = { 'D', 'I', 'W', 'E' };
-        *this << "[" << utils::getCurrentTime("%Y-%m-%d %H:%M:%S") << "] [" << levels[log.level()] << "] ";
+        *this << "[" << utils::formatTimestamp(std::chrono::system_clock::now()) << "] [" << levels[log.level()] << "] ";
 
         if (m_printFileAndLine)
             *this << log.file() << ":" << log.line() << ": ";
@@ -62,11 +77,13 @@ public:
         if (!log.sourceName().empty())
             *this << "[" << log.sourceName() << "] ";
 
-        *this << log.message() << std::endl;
+        printMessage(log);
+        *this << '\n';
     }
 
 private:
     std::ofstream m_file;
+    std::unique_ptr<LogRotator> m_rotator;
 
     bool m_printFileAndLine = false;
 };
@@ -1,59 +1,116 @@
 #ifndef LOG_HPP_
 #define LOG_HPP_
 
+#include <array>
+#include <cstring>
 #include <string>
+#include <string_view>
 
 #include "common/logger/LoggerUtils.hpp"
+#include "common/utils/IntTypes.hpp"
 
+// Move-only, a record is built once and moved into the log ring.
+// Records with a format id are binary log events: the message holds the
+// encoded arguments of that format instead of text. Text that fits in
+// INLINE_CAPACITY is kept inside the record, so it never touches the heap.
 class Log {
 
 public:
+    static constexpr std::size_t INLINE_CAPACITY = 256;
+
+    // sourceName is not copied, it must outlive the record
     Log(LogLevel level = LogLevel::Debug, const char* file = nullptr, int line = -1,
-        const std::string& sourceName = "", const std::string& message = "")
+        std::string_view sourceName = {}, std::string message = "", u32 formatId = 0, u64 timestamp = 0)
         : m_level(level)
         , m_file(file)
         , m_line(line)
         , m_sourceName(sourceName)
-        , m_message(message)
+        , m_message(std::move(message))
+        , m_formatId(formatId)
+        , m_timestamp(timestamp)
+    {
+    }
+
+    // Copies message into the record, on the heap only if it doesn't fit inline.
+    Log(LogLevel level, const char* file, int line, std::string_view sourceName, std::string_view message,
+        u32 formatId, u64 timestamp)
+        : Log(level, file, line, sourceName, std::string(), formatId, timestamp)
+    {
+        if (message.size() <= INLINE_CAPACITY) {
+            std::memcpy(m_inline.data(), message.data(), message.size());
+            m_inlineSize = static_cast<u32>(message.size());
+            m_isInline = true;
+        } else {
+            m_message.assign(message);
+        }
+    }
+
+    Log(Log&& other) noexcept
     {
+        *this = std::move(other);
     }
 
-    Log(const Log& other)
+    Log& operator=(Log&& other) noexcept
     {
         m_level = other.m_level;
         m_file = other.m_file;
         m_line = other.m_line;
         m_sourceName = other.m_sourceName;
-        m_message = other.m_message;
+        m_message = std::move(other.m_message);
+        m_formatId = other.m_formatId;
+        m_timestamp = other.m_timestamp;
+        // only the used part of the inline buffer
+        m_isInline = other.m_isInline;
+        m_inlineSize = other.m_inlineSize;
+        std::memcpy(m_inline.data(), other.m_inline.data(), m_inlineSize);
+        return *this;
     }
 
+    Log(const Log&) = delete;
+    Log& operator=(const Log&) = delete;
+
     LogLevel level() const
     {
         return m_level;
     }
-    std::string sourceName() const
+    std::string_view sourceName() const
     {
         return m_sourceName;
     }
-    std::string file() const
+    const char* file() const
     {
-        return m_file;
+        return m_file ? m_file : "";
     }
     int line() const
     {
         return m_line;
     }
-    std::string message() const
+    std::string_view message() const
+    {
+        return m_isInline ? std::string_view(m_inline.data(), m_inlineSize) : std::string_view(m_message);
+    }
+    u32 formatId() const
     {
-        return m_message;
+        return m_formatId;
+    }
+    // monotonic nanoseconds, 0 when the producer did not stamp the record
+    u64 timestamp() const
+    {
+        return m_timestamp;
     }
 
 private:
     LogLevel m_level;
     const char* m_file = nullptr;
     int m_line = -1;
-    std::string m_sourceName;
+    std::string_view m_sourceName;
     std::string m_message;
+    u32 m_formatId = 0;
+    u64 m_timestamp = 0;
+
+    bool m_isInline = false;
+    u32 m_inlineSize = 0;
+    std::array<char, INLINE_CAPACITY> m_inline;
 };
 
-#endif /* LOG_HPP_ */
\ No newline at end of file
+#endif /* LOG_HPP_ */
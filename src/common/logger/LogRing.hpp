@@ -0,0 +1,103 @@
+#ifndef LOGRING_HPP_
+#define LOGRING_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "common/logger/Log.hpp"
+
+/*
+ * Bounded multi-producer, single-consumer queue of Log records.
+ * Slots are preallocated and each carries a sequence number (Vyukov's
+ * bounded queue): producers claim a slot with one CAS on the tail and
+ * publish it with a release store; the consumer never takes a lock.
+ */
+class LogRing {
+public:
+    // capacity is rounded up to a power of two
+    explicit LogRing(std::size_t capacity)
+    {
+        m_capacity = 2;
+        while (m_capacity < capacity) {
+            m_capacity <<= 1;
+        }
+        m_mask = m_capacity - 1;
+
+        m_slots = std::make_unique<Slot[]>(m_capacity);
+        for (std::size_t i = 0; i < m_capacity; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LogRing(const LogRing&) = delete;
+    LogRing& operator=(const LogRing&) = delete;
+
+    // false when the ring is full, the record is left untouched
+    bool tryPush(Log& log)
+    {
+        std::size_t pos = m_tail.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &m_slots[pos & m_mask];
+            std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->log = std::move(log);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer only
+    bool tryPop(Log& log)
+    {
+        Slot& slot = m_slots[m_head & m_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != m_head + 1) {
+            return false;
+        }
+
+        log = std::move(slot.log);
+        slot.sequence.store(m_head + m_capacity, std::memory_order_release);
+        ++m_head;
+        return true;
+    }
+
+    // consumer only
+    bool empty() const
+    {
+        return m_slots[m_head & m_mask].sequence.load(std::memory_order_acquire) != m_head + 1;
+    }
+
+    // consumer only, exact while no producer is pushing
+    std::size_t size() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head;
+    }
+
+    std::size_t capacity() const { return m_capacity; }
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<std::size_t> sequence;
+        Log log;
+    };
+
+    std::size_t m_capacity;
+    std::size_t m_mask;
+    std::unique_ptr<Slot[]> m_slots;
+
+    alignas(64) std::atomic<std::size_t> m_tail = 0;
+    alignas(64) std::size_t m_head = 0;
+};
+
+#endif /* LOGRING_HPP_ */
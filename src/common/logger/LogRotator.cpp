@@ -0,0 +1,210 @@
+#include "common/logger/LogRotator.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "common/utils/Utils.hpp"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr const char* COMPRESSED_SUFFIX = ".gz";
+
+void lowerThreadPriority()
+{
+    pid_t tid = static_cast<pid_t>(::syscall(SYS_gettid));
+    ::setpriority(PRIO_PROCESS, tid, 19);
+
+    // IOPRIO_CLASS_IDLE, only gets the disk when nobody else wants it
+    constexpr int IOPRIO_WHO_PROCESS = 1;
+    constexpr int IOPRIO_CLASS_IDLE = 3;
+    constexpr int IOPRIO_CLASS_SHIFT = 13;
+    ::syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, tid, IOPRIO_CLASS_IDLE << IOPRIO_CLASS_SHIFT);
+}
+
+} // namespace
+
+LogRotator::LogRotator(const fs::path& path, LogRotationConfig config, utils::ThreadPlacement placement)
+    : m_config(config)
+    , m_placement(std::move(placement))
+    , m_directory(path.parent_path())
+    , m_extension(path.extension().string())
+    , m_currentPath(path)
+    , m_deadline(std::chrono::steady_clock::now() + config.interval)
+{
+    m_thread = std::thread(&LogRotator::run, this);
+}
+
+LogRotator::~LogRotator()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isRunning = false;
+    }
+    m_cv.notify_one();
+    m_thread.join();
+}
+
+bool LogRotator::shouldRotate(u64 fileSize) const
+{
+    if (m_config.maxFileSize > 0 && fileSize >= m_config.maxFileSize) {
+        return true;
+    }
+    return m_config.interval.count() > 0 && std::chrono::steady_clock::now() >= m_deadline;
+}
+
+fs::path LogRotator::rotate()
+{
+    fs::path closed = m_currentPath;
+    m_currentPath = nextPath();
+    m_deadline = std::chrono::steady_clock::now() + m_config.interval;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_closed.push_back(std::move(closed));
+    }
+    m_cv.notify_one();
+
+    return m_currentPath;
+}
+
+fs::path LogRotator::nextPath()
+{
+    // same naming as the first segment, with a counter if a second produces
+    // several; zero padded so names keep sorting chronologically
+    std::string stem = utils::getCurrentTime("%Y-%m-%d_%H-%M-%S");
+    if (stem != m_lastStem) {
+        m_lastStem = stem;
+        m_counter = 0;
+    }
+
+    fs::path path = m_directory / (stem + m_extension);
+    while (m_counter > 0 || path == m_currentPath || fs::exists(path) || fs::exists(path.string() + COMPRESSED_SUFFIX)) {
+        char counter[16];
+        std::snprintf(counter, sizeof(counter), "_%04d", ++m_counter);
+        path = m_directory / (stem + counter + m_extension);
+        if (!fs::exists(path) && !fs::exists(path.string() + COMPRESSED_SUFFIX)) {
+            break;
+        }
+    }
+    return path;
+}
+
+void LogRotator::run()
+{
+    m_placement.apply();
+    lowerThreadPriority();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this]() { return !m_closed.empty() || !m_isRunning; });
+        if (m_closed.empty()) {
+            break;
+        }
+
+        fs::path path = std::move(m_closed.front());
+        m_closed.pop_front();
+
+        lock.unlock();
+        if (m_config.compress) {
+            compress(path);
+        }
+        enforceRetention();
+        lock.lock();
+    }
+}
+
+void LogRotator::compress(const fs::path& path)
+{
+    std::error_code ec;
+    // already removed by retention while it waited in the queue
+    if (!fs::exists(path, ec)) {
+        return;
+    }
+
+    std::ifstream input(path, std::ios::binary);
+    fs::path target = path.string() + COMPRESSED_SUFFIX;
+    gzFile output = gzopen(target.c_str(), "wb6");
+    if (!input || !output) {
+        std::cerr << "Log rotation: can't compress '" << path.string() << "'" << std::endl;
+        if (output) {
+            gzclose(output);
+        }
+        return;
+    }
+
+    std::vector<char> buffer(256 * 1024);
+    bool ok = true;
+    while (ok && input) {
+        input.read(buffer.data(), buffer.size());
+        auto count = input.gcount();
+        ok = count == 0 || gzwrite(output, buffer.data(), static_cast<unsigned>(count)) == count;
+    }
+    ok = gzclose(output) == Z_OK && ok;
+
+    // keep the original if anything went wrong, better an uncompressed log than none
+    fs::remove(ok ? path : target, ec);
+}
+
+void LogRotator::enforceRetention()
+{
+    if (m_config.maxFiles == 0) {
+        return;
+    }
+
+    // one entry per segment: X.log and an X.log.gz still being written, or
+    // left behind by a failed compression, are the same segment
+    std::error_code ec;
+    std::map<std::string, std::vector<fs::path>> segments;
+    for (const auto& entry : fs::directory_iterator(m_directory, ec)) {
+        std::string name = entry.path().filename().string();
+        if (name.ends_with(COMPRESSED_SUFFIX)) {
+            name.resize(name.size() - std::strlen(COMPRESSED_SUFFIX));
+        }
+        if (isSegmentName(name) && entry.is_regular_file()) {
+            segments[name].push_back(entry.path());
+        }
+    }
+
+    // the active segment is the newest one and always counted
+    std::size_t keep = std::size_t(m_config.maxFiles) + 1;
+    // timestamp names sort chronologically
+    for (auto it = segments.begin(); segments.size() > keep; it = segments.erase(it)) {
+        for (const auto& path : it->second) {
+            fs::remove(path, ec);
+        }
+    }
+}
+
+bool LogRotator::isSegmentName(std::string_view name) const
+{
+    // <%Y-%m-%d_%H-%M-%S>[_NNNN]<extension>, as named by ServerApplication
+    // and nextPath, so other files in the directory are never touched
+    constexpr std::string_view STAMP = "dddd-dd-dd_dd-dd-dd";
+    if (!name.ends_with(m_extension)) {
+        return false;
+    }
+    name.remove_suffix(m_extension.size());
+    if (name.size() != STAMP.size() && name.size() != STAMP.size() + 5) {
+        return false;
+    }
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        char expected = i < STAMP.size() ? STAMP[i] : (i == STAMP.size() ? '_' : 'd');
+        bool ok = expected == 'd' ? std::isdigit(static_cast<unsigned char>(name[i])) != 0 : name[i] == expected;
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
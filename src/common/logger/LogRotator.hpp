@@ -0,0 +1,79 @@
+#ifndef LOGROTATOR_HPP_
+#define LOGROTATOR_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "common/utils/IntTypes.hpp"
+#include "common/utils/ThreadUtils.hpp"
+
+struct LogRotationConfig {
+    // 0 disables the size limit
+    u64 maxFileSize = 0;
+    // 0 disables time based rotation
+    std::chrono::seconds interval { 0 };
+    // gzip closed segments
+    bool compress = true;
+    // closed segments kept in the log directory, 0 keeps all; once set, older
+    // runs' segments in the same directory count too and are removed first
+    u32 maxFiles = 0;
+};
+
+/*
+ * Decides when a file sink starts a new segment and takes care of the old
+ * ones. File sinks ask between batches, on the logger thread, so producers
+ * never wait for a file swap. Closed segments are compressed and the
+ * retention cap enforced on a background thread at idle CPU and I/O priority.
+ */
+class LogRotator {
+public:
+    // path is the first segment; the next ones go next to it with the same extension
+    LogRotator(const std::filesystem::path& path, LogRotationConfig config, utils::ThreadPlacement placement);
+    ~LogRotator();
+
+    LogRotator(const LogRotator&) = delete;
+    LogRotator& operator=(const LogRotator&) = delete;
+
+    const std::filesystem::path& currentPath() const { return m_currentPath; }
+
+    bool shouldRotate(u64 fileSize) const;
+
+    // Hands the current segment, already closed by the sink, to the
+    // background thread and returns the path of the next one.
+    std::filesystem::path rotate();
+
+private:
+    std::filesystem::path nextPath();
+
+    void run();
+    void compress(const std::filesystem::path& path);
+    void enforceRetention();
+    bool isSegmentName(std::string_view name) const;
+
+private:
+    LogRotationConfig m_config;
+    utils::ThreadPlacement m_placement;
+
+    std::filesystem::path m_directory;
+    std::string m_extension;
+    std::filesystem::path m_currentPath;
+    // counter for segments opened within the same second, only ever grows
+    // so a name freed by retention is never handed out again
+    std::string m_lastStem;
+    int m_counter = 0;
+    std::chrono::steady_clock::time_point m_deadline;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::filesystem::path> m_closed;
+    bool m_isRunning = true;
+    std::thread m_thread;
+};
+
+#endif /* LOGROTATOR_HPP_ */
@@ -1,5 +1,6 @@
 #include "common/logger/LogStream.hpp"
 
+#include "common/logger/BinaryLog.hpp"
 #include "common/logger/Log.hpp"
 #include "common/logger/LoggerHandler.hpp"
 
@@ -10,5 +11,11 @@ LogStream::~LogStream()
     if (!isEnabled || m_level == LogLevel::None)
         return;
 
-    LoggerHandler::getInstance().post(Log(m_level, m_file, m_line, m_sourceName, m_stream.str()));
+    // lines that fit the stack buffer are copied into the record, only long
+    // ones hand over their heap string
+    if (m_overflow.empty()) {
+        LoggerHandler::getInstance().post(Log(m_level, m_file, m_line, m_sourceName, view(), 0, binlog::monotonicNow()));
+    } else {
+        LoggerHandler::getInstance().post(Log(m_level, m_file, m_line, m_sourceName, std::move(m_overflow), 0, binlog::monotonicNow()));
+    }
 }
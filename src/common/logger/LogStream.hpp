@@ -1,15 +1,26 @@
 #ifndef LOGSTREAM_HPP_
 #define LOGSTREAM_HPP_
 
+#include <array>
+#include <charconv>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
+#include "common/logger/Log.hpp"
 #include "common/logger/LoggerUtils.hpp"
 
+// Formats into a stack buffer and only falls back to the heap for long
+// lines; types without a fast path still go through an ostringstream.
 class LogStream {
 public:
+    // sized to match Log, a line that fits here fits in the record too
+    static constexpr std::size_t INLINE_CAPACITY = Log::INLINE_CAPACITY;
+
     LogStream(LogLevel level = LogLevel::Debug, const char* file = nullptr, int line = -1,
-        const std::string& sourceName = "")
+        std::string_view sourceName = {})
         : m_level(level)
         , m_file(file)
         , m_line(line)
@@ -17,45 +28,101 @@ public:
     {
     }
 
+    LogStream(const LogStream&) = delete;
+    LogStream& operator=(const LogStream&) = delete;
+
     ~LogStream();
 
     void addSpace()
     {
-        if (!m_stream.str().empty())
-            m_stream << " ";
+        if (m_size > 0)
+            append(" ");
     }
 
     template <typename T>
     LogStream& operator<<(const T& object)
     {
         addSpace();
-        m_stream << object;
+        write(object);
         return *this;
     }
     LogStream& operator<<(const char* str)
     {
         addSpace();
-        m_stream << str;
+        append(str ? str : "(null)");
         return *this;
     }
     LogStream& operator<<(const std::string& str)
     {
         addSpace();
-        m_stream << "\"" << str << "\"";
+        append("\"");
+        append(str);
+        append("\"");
         return *this;
     }
 
+    std::string_view view() const
+    {
+        return m_overflow.empty() ? std::string_view(m_buffer.data(), m_size) : std::string_view(m_overflow);
+    }
+
     static bool isEnabled;
 
+private:
+    void append(std::string_view text)
+    {
+        if (m_overflow.empty() && m_size + text.size() <= INLINE_CAPACITY) {
+            std::memcpy(m_buffer.data() + m_size, text.data(), text.size());
+            m_size += text.size();
+            return;
+        }
+
+        if (m_overflow.empty())
+            m_overflow.assign(m_buffer.data(), m_size);
+        m_overflow.append(text);
+        m_size = m_overflow.size();
+    }
+
+    template <typename T>
+    void write(const T& value)
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            append(value ? "1" : "0");
+        } else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>) {
+            append(std::string_view(reinterpret_cast<const char*>(&value), 1));
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            char digits[64];
+            auto result = std::to_chars(digits, digits + sizeof(digits), value);
+            append(std::string_view(digits, result.ptr - digits));
+        } else if constexpr (std::is_enum_v<T>) {
+            // promoted, so u8 based enums print as numbers
+            write(+static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            append(std::string_view(value));
+        } else {
+            std::ostringstream stream;
+            stream << value;
+            append(stream.str());
+        }
+    }
+
 private:
     LogLevel m_level;
 
     const char* m_file = nullptr;
     int m_line = -1;
 
-    std::string m_sourceName;
+    std::string_view m_sourceName;
+
+    std::array<char, INLINE_CAPACITY> m_buffer;
+    std::size_t m_size = 0;
+    std::string m_overflow;
+};
 
-    std::stringstream m_stream;
+// Gives the `cond ? (void)0 : stream << ...` form in the log macros a void
+// right-hand side; & binds looser than <<, so the whole chain is inside it.
+struct LogVoidify {
+    void operator&(const LogStream&) { }
 };
 
-#endif /* LOGSTREAM_HPP_ */
\ No newline at end of file
+#endif /* LOGSTREAM_HPP_ */
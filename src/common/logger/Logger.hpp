@@ -1,19 +1,34 @@
 #ifndef LOGGER_HPP_
 #define LOGGER_HPP_
 
-#include <string>
+#include <string_view>
 
+#include "common/logger/BinaryLog.hpp"
 #include "common/logger/Log.hpp"
 
 class Logger {
 public:
+    virtual ~Logger() = default;
+
     virtual void print(const Log& log) = 0;
+    // called once per drained batch, print() itself does not flush
+    virtual void flush() = 0;
 
 public:
-    virtual Logger& operator<<(const std::string& str) = 0;
+    virtual Logger& operator<<(std::string_view str) = 0;
     virtual Logger& operator<<(int i) = 0;
     virtual Logger& operator<<(char c) = 0;
     virtual Logger& operator<<(std::ostream& (*f)(std::ostream&)) = 0;
+
+protected:
+    // text records as they are, binary events rendered through their format
+    void printMessage(const Log& log)
+    {
+        if (log.formatId() != 0)
+            *this << binlog::render(binlog::getFormat(log.formatId()).format, log.message());
+        else
+            *this << log.message();
+    }
 };
 
 #endif /* LOGGER_HPP_ */
@@ -1,29 +1,139 @@
 #include "common/logger/LoggerHandler.hpp"
 
+#include <algorithm>
+#include <string>
+
+namespace {
+
+// records printed between two flushes of the loggers
+constexpr std::size_t DRAIN_BATCH = 256;
+
+} // namespace
+
+LoggerHandler::~LoggerHandler()
+{
+    if (!m_thread.joinable()) {
+        return;
+    }
+
+    m_isRunning = false;
+    wakeConsumer();
+    m_thread.join();
+}
+
+void LoggerHandler::init(LogLevel maxLevel, const std::string& name, const std::string& filename, utils::ThreadPlacement placement,
+    std::size_t bufferSize, LogOverflow overflow, LogFileFormat fileFormat, LogRotationConfig rotation)
+{
+    s_maxLevel.store(maxLevel, std::memory_order_relaxed);
+    m_name = name;
+    m_placement = std::move(placement);
+    m_overflow = overflow;
+
+    // single threaded still, carry over what was logged so far; the new ring
+    // is never smaller than that backlog, so nothing is lost when shrinking
+    if (bufferSize != m_ring->capacity()) {
+        auto ring = std::make_unique<LogRing>(std::max(bufferSize, m_ring->size()));
+        Log log;
+        while (m_ring->tryPop(log)) {
+            ring->tryPush(log);
+        }
+        m_ring = std::move(ring);
+    }
+
+    std::unique_ptr<LogRotator> rotator;
+    if (rotation.maxFileSize > 0 || rotation.interval.count() > 0) {
+        // compression shares the logger's cores
+        rotator = std::make_unique<LogRotator>(filename, rotation, utils::ThreadPlacement { m_placement.name + "-rot", m_placement.cpus });
+    }
+
+    if (fileFormat == LogFileFormat::Binary) {
+        m_loggers.push_back(std::make_unique<BinaryFileLogger>(filename, m_name, std::move(rotator)));
+    } else {
+        m_loggers.push_back(std::make_unique<FileLogger>(filename, std::move(rotator)));
+    }
+    m_loggers.push_back(std::make_unique<ConsoleLogger>());
+
+    m_isRunning = true;
+    m_thread = std::thread(&LoggerHandler::run, this);
+}
+
 void LoggerHandler::run()
 {
-    while (m_isRunning) {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        m_cv.wait(lock, [this]() { return !m_queue.empty() || !m_isRunning; });
-
-        while (!m_queue.empty()) {
-            auto log = m_queue.front();
-            m_queue.pop();
-            for (auto& stream : m_loggers) {
-                stream->print(log);
-            }
+    // kept off the I/O cores; nowhere to report a failure from here
+    m_placement.apply();
+
+    while (m_isRunning.load(std::memory_order_acquire)) {
+        if (drain() > 0) {
+            continue;
         }
+
+        u32 wakeups = m_wakeups.load(std::memory_order_acquire);
+        m_consumerSleeping.store(true, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // a producer that missed the flag has already published its record
+        if (m_ring->empty() && m_isRunning.load(std::memory_order_acquire)) {
+            m_wakeups.wait(wakeups, std::memory_order_acquire);
+        }
+        m_consumerSleeping.store(false, std::memory_order_relaxed);
     }
+
+    while (drain() > 0) { }
+}
+
+std::size_t LoggerHandler::drain()
+{
+    std::size_t count = 0;
+    Log log;
+    while (count < DRAIN_BATCH && m_ring->tryPop(log)) {
+        for (auto& stream : m_loggers) {
+            stream->print(log);
+        }
+        ++count;
+    }
+
+    u64 dropped = m_dropped.load(std::memory_order_relaxed);
+    if (dropped != m_reportedDropped) {
+        Log warning(LogLevel::Warning, nullptr, -1, m_name,
+            "Log buffer full, dropped " + std::to_string(dropped - m_reportedDropped) + " messages");
+        for (auto& stream : m_loggers) {
+            stream->print(warning);
+        }
+        m_reportedDropped = dropped;
+        ++count;
+    }
+
+    if (count > 0) {
+        for (auto& stream : m_loggers) {
+            stream->flush();
+        }
+    }
+    return count;
+}
+
+void LoggerHandler::wakeConsumer()
+{
+    m_wakeups.fetch_add(1, std::memory_order_release);
+    m_wakeups.notify_one();
 }
 
 LogStream LoggerHandler::print(LogLevel level, const char* file, int line)
 {
-    return { level >= m_maxLevel ? level : LogLevel::None, file, line, m_name };
+    return { isEnabled(level) ? level : LogLevel::None, file, line, m_name };
 }
 
 void LoggerHandler::post(Log&& log)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_queue.push(std::move(log));
-    m_cv.notify_one();
-}
\ No newline at end of file
+    while (!m_ring->tryPush(log)) {
+        // nothing drains the ring before init() starts the thread, blocking would hang
+        if (m_overflow == LogOverflow::Drop || !m_isRunning.load(std::memory_order_acquire)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_consumerSleeping.load(std::memory_order_relaxed)) {
+        wakeConsumer();
+    }
+}
@@ -1,57 +1,67 @@
 #ifndef LOGGERHANDLER_HPP_
 #define LOGGERHANDLER_HPP_
 
-#include <condition_variable>
+#include <atomic>
 #include <memory>
-#include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
+#include "common/logger/BinaryFileLogger.hpp"
+#include "common/logger/BinaryLog.hpp"
 #include "common/logger/ConsoleLogger.hpp"
 #include "common/logger/FileLogger.hpp"
 #include "common/logger/Log.hpp"
+#include "common/logger/LogRing.hpp"
+#include "common/logger/LogRotator.hpp"
 #include "common/logger/LogStream.hpp"
 #include "common/logger/Logger.hpp"
+#include "common/utils/ThreadUtils.hpp"
 
 class LogStream;
 
 class LoggerHandler {
 public:
-    ~LoggerHandler()
-    {
-        m_isRunning = false;
-        m_cv.notify_one();
-        m_thread.join();
-    }
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 8192;
+
+    ~LoggerHandler();
 
     LogStream print(LogLevel level, const char* file, int line);
 
     void post(Log&& log);
 
-    LogLevel maxLevel() const
+    // Binary log event, only the arguments are encoded on the calling thread.
+    template <typename... Args>
+    void postEvent(LogLevel level, u32 formatId, const Args&... args)
     {
-        return m_maxLevel;
+        post(Log(level, nullptr, -1, m_name, binlog::encodeArgs(args...), formatId, binlog::monotonicNow()));
     }
 
-    static LoggerHandler& getInstance()
+    LogLevel maxLevel() const
     {
-        static LoggerHandler instance;
-        return instance;
+        return s_maxLevel.load(std::memory_order_relaxed);
     }
 
-    void init(LogLevel maxLevel, const std::string& name, const std::string& filename)
+    // The runtime half of the check in the log macros, one relaxed load.
+    static bool isEnabled(LogLevel level)
     {
-        m_maxLevel = maxLevel;
-        m_name = name;
+        return level >= s_maxLevel.load(std::memory_order_relaxed) && LogStream::isEnabled;
+    }
 
-        m_loggers.push_back(std::make_unique<FileLogger>(filename));
-        m_loggers.push_back(std::make_unique<ConsoleLogger>());
+    u64 droppedCount() const
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
 
-        m_isRunning = true;
-        m_thread = std::thread(&LoggerHandler::run, this);
+    static LoggerHandler& getInstance()
+    {
+        static LoggerHandler instance;
+        return instance;
     }
 
+    void init(LogLevel maxLevel, const std::string& name, const std::string& filename, utils::ThreadPlacement placement = {},
+        std::size_t bufferSize = DEFAULT_BUFFER_SIZE, LogOverflow overflow = LogOverflow::Block, LogFileFormat fileFormat = LogFileFormat::Text,
+        LogRotationConfig rotation = {});
+
 private:
     LoggerHandler() = default;
 
@@ -60,17 +70,27 @@ private:
 
 private:
     std::string m_name;
-    LogLevel m_maxLevel;
+    static inline std::atomic<LogLevel> s_maxLevel = LogLevel::Debug;
     std::vector<std::unique_ptr<Logger>> m_loggers;
+    utils::ThreadPlacement m_placement;
 
 private:
     void run();
+    std::size_t drain();
+    void wakeConsumer();
 
-    bool m_isRunning;
-    std::mutex m_mutex;
+    std::atomic<bool> m_isRunning = false;
     std::thread m_thread;
-    std::queue<Log> m_queue;
-    std::condition_variable m_cv;
+
+    // records posted before init() wait here until the thread starts
+    std::unique_ptr<LogRing> m_ring = std::make_unique<LogRing>(DEFAULT_BUFFER_SIZE);
+    LogOverflow m_overflow = LogOverflow::Block;
+    std::atomic<u64> m_dropped = 0;
+    u64 m_reportedDropped = 0;
+
+    // producers only touch the futex when the consumer said it is going to sleep
+    std::atomic<bool> m_consumerSleeping = false;
+    std::atomic<u32> m_wakeups = 0;
 };
 
 #endif // LOGGERHANDLER_HPP_
@@ -15,6 +15,18 @@ enum LogLevel : u8 {
     None = 4
 };
 
+// What a producer does when the log ring is full.
+enum class LogOverflow : u8 {
+    Block,
+    Drop,
+};
+
+enum class LogFileFormat : u8 {
+    Text,
+    // see BinaryLog.hpp, read back with the logdecoder tool
+    Binary,
+};
+
 enum class LoggerColor : u8 {
     White = 7,
     Red = 1,
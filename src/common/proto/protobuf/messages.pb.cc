@@ -16,95 +16,152 @@
 #include <google/protobuf/port_def.inc>
 
 PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
 namespace messages {
-constexpr ClientConnectRequest::ClientConnectRequest(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : token_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , clientid_(int64_t{0}){}
+PROTOBUF_CONSTEXPR ClientConnectRequest::ClientConnectRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.token_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.clientid_)*/int64_t{0}} {}
 struct ClientConnectRequestDefaultTypeInternal {
-  constexpr ClientConnectRequestDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR ClientConnectRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~ClientConnectRequestDefaultTypeInternal() {}
   union {
     ClientConnectRequest _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ClientConnectRequestDefaultTypeInternal _ClientConnectRequest_default_instance_;
-constexpr ClientConnectResponse::ClientConnectResponse(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : statuscode_(0)
-{}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientConnectRequestDefaultTypeInternal _ClientConnectRequest_default_instance_;
+PROTOBUF_CONSTEXPR ClientConnectResponse::ClientConnectResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.statuscode_)*/0} {}
 struct ClientConnectResponseDefaultTypeInternal {
-  constexpr ClientConnectResponseDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR ClientConnectResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~ClientConnectResponseDefaultTypeInternal() {}
   union {
     ClientConnectResponse _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ClientConnectResponseDefaultTypeInternal _ClientConnectResponse_default_instance_;
-constexpr Frame::Frame(
-  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : data_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
-  , msgid_(0)
-
-  , frameid_(0){}
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientConnectResponseDefaultTypeInternal _ClientConnectResponse_default_instance_;
+PROTOBUF_CONSTEXPR Echo::Echo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.text_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct EchoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EchoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EchoDefaultTypeInternal() {}
+  union {
+    Echo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EchoDefaultTypeInternal _Echo_default_instance_;
+PROTOBUF_CONSTEXPR FrameBatch::FrameBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frames_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrameBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrameBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrameBatchDefaultTypeInternal() {}
+  union {
+    FrameBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameBatchDefaultTypeInternal _FrameBatch_default_instance_;
+PROTOBUF_CONSTEXPR Frame::Frame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.msgid_)*/0
+  , /*decltype(_impl_.frameid_)*/0
+  , /*decltype(_impl_.compressed_)*/false} {}
 struct FrameDefaultTypeInternal {
-  constexpr FrameDefaultTypeInternal()
-    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  PROTOBUF_CONSTEXPR FrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
   ~FrameDefaultTypeInternal() {}
   union {
     Frame _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT FrameDefaultTypeInternal _Frame_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameDefaultTypeInternal _Frame_default_instance_;
 }  // namespace messages
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_messages_2eproto[3];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_messages_2eproto[2];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_messages_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_messages_2eproto[5];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_messages_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_messages_2eproto = nullptr;
 
 const uint32_t TableStruct_messages_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectRequest, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::messages::ClientConnectRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectRequest, clientid_),
-  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectRequest, token_),
+  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectRequest, _impl_.clientid_),
+  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectRequest, _impl_.token_),
   1,
   0,
-  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectResponse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectResponse, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::messages::ClientConnectResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectResponse, statuscode_),
+  PROTOBUF_FIELD_OFFSET(::messages::ClientConnectResponse, _impl_.statuscode_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::messages::Echo, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::messages::Echo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::messages::Echo, _impl_.text_),
   0,
-  PROTOBUF_FIELD_OFFSET(::messages::Frame, _has_bits_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::messages::FrameBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::messages::FrameBatch, _impl_.frames_),
+  PROTOBUF_FIELD_OFFSET(::messages::Frame, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::messages::Frame, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::messages::Frame, msgid_),
-  PROTOBUF_FIELD_OFFSET(::messages::Frame, frameid_),
-  PROTOBUF_FIELD_OFFSET(::messages::Frame, data_),
+  PROTOBUF_FIELD_OFFSET(::messages::Frame, _impl_.msgid_),
+  PROTOBUF_FIELD_OFFSET(::messages::Frame, _impl_.frameid_),
+  PROTOBUF_FIELD_OFFSET(::messages::Frame, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::messages::Frame, _impl_.compressed_),
   ~0u,
   1,
   0,
+  2,
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 8, -1, sizeof(::messages::ClientConnectRequest)},
   { 10, 17, -1, sizeof(::messages::ClientConnectResponse)},
-  { 18, 27, -1, sizeof(::messages::Frame)},
+  { 18, 25, -1, sizeof(::messages::Echo)},
+  { 26, -1, -1, sizeof(::messages::FrameBatch)},
+  { 33, 43, -1, sizeof(::messages::Frame)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::messages::_ClientConnectRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::messages::_ClientConnectResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::messages::_Frame_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::messages::_ClientConnectRequest_default_instance_._instance,
+  &::messages::_ClientConnectResponse_default_instance_._instance,
+  &::messages::_Echo_default_instance_._instance,
+  &::messages::_FrameBatch_default_instance_._instance,
+  &::messages::_Frame_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_messages_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -113,33 +170,39 @@ const char descriptor_table_protodef_messages_2eproto[] PROTOBUF_SECTION_VARIABL
   "en\030\002 \001(\tH\001\210\001\001B\013\n\t_clientIdB\010\n\006_token\"V\n\025"
   "ClientConnectResponse\022.\n\nstatusCode\030\001 \001("
   "\0162\025.messages.STATUS_CODEH\000\210\001\001B\r\n\013_status"
-  "Code\"f\n\005Frame\022\037\n\005msgId\030\001 \001(\0162\020.messages."
-  "MSG_ID\022\024\n\007frameId\030\002 \001(\005H\000\210\001\001\022\021\n\004data\030\003 \001"
-  "(\014H\001\210\001\001B\n\n\010_frameIdB\007\n\005_data*\261\001\n\006MSG_ID\022"
-  "\026\n\022MSG_CLIENT_CONNECT\020\000\022\031\n\025MSG_CLIENT_DI"
-  "SCONNECT\020\001\022\021\n\rMSG_CLIENT_OK\020\002\022\026\n\022MSG_CLI"
-  "ENT_REFUSED\020\003\022\030\n\024MSG_CLIENT_HEARTBEAT\020\004\022"
-  "\024\n\020MSG_SERVER_CLOSE\020\020\022\031\n\025MSG_SERVER_DISC"
-  "ONNECT\020\021*\313\001\n\013STATUS_CODE\022\013\n\007STAT_OK\020\000\022\033\n"
-  "\027STAT_CONNECTION_REFUSED\020\020\022\033\n\027STAT_CONNE"
-  "CTION_TIMEOUT\020\021\022\025\n\021STAT_SERVER_ERROR\020 \022\026"
-  "\n\022STAT_TOKEN_INVALID\0200\022\026\n\022STAT_TOKEN_EXP"
-  "IRED\0201\022\025\n\021STAT_CLIENT_ERROR\020@\022\027\n\023STAT_CL"
-  "IENT_INVALID\020Ab\006proto3"
+  "Code\"\"\n\004Echo\022\021\n\004text\030\001 \001(\tH\000\210\001\001B\007\n\005_text"
+  "\"\034\n\nFrameBatch\022\016\n\006frames\030\001 \003(\014\"\216\001\n\005Frame"
+  "\022\037\n\005msgId\030\001 \001(\0162\020.messages.MSG_ID\022\024\n\007fra"
+  "meId\030\002 \001(\005H\000\210\001\001\022\021\n\004data\030\003 \001(\014H\001\210\001\001\022\027\n\nco"
+  "mpressed\030\004 \001(\010H\002\210\001\001B\n\n\010_frameIdB\007\n\005_data"
+  "B\r\n\013_compressed*\325\001\n\006MSG_ID\022\026\n\022MSG_CLIENT"
+  "_CONNECT\020\000\022\031\n\025MSG_CLIENT_DISCONNECT\020\001\022\021\n"
+  "\rMSG_CLIENT_OK\020\002\022\026\n\022MSG_CLIENT_REFUSED\020\003"
+  "\022\030\n\024MSG_CLIENT_HEARTBEAT\020\004\022\024\n\020MSG_SERVER"
+  "_CLOSE\020\020\022\031\n\025MSG_SERVER_DISCONNECT\020\021\022\024\n\020M"
+  "SG_SERVER_BATCH\020\022\022\014\n\010MSG_ECHO\020 *\313\001\n\013STAT"
+  "US_CODE\022\013\n\007STAT_OK\020\000\022\033\n\027STAT_CONNECTION_"
+  "REFUSED\020\020\022\033\n\027STAT_CONNECTION_TIMEOUT\020\021\022\025"
+  "\n\021STAT_SERVER_ERROR\020 \022\026\n\022STAT_TOKEN_INVA"
+  "LID\0200\022\026\n\022STAT_TOKEN_EXPIRED\0201\022\025\n\021STAT_CL"
+  "IENT_ERROR\020@\022\027\n\023STAT_CLIENT_INVALID\020Ab\006p"
+  "roto3"
   ;
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_messages_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto = {
-  false, false, 702, descriptor_table_protodef_messages_2eproto, "messages.proto", 
-  &descriptor_table_messages_2eproto_once, nullptr, 0, 3,
-  schemas, file_default_instances, TableStruct_messages_2eproto::offsets,
-  file_level_metadata_messages_2eproto, file_level_enum_descriptors_messages_2eproto, file_level_service_descriptors_messages_2eproto,
+static ::_pbi::once_flag descriptor_table_messages_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_messages_2eproto = {
+    false, false, 845, descriptor_table_protodef_messages_2eproto,
+    "messages.proto",
+    &descriptor_table_messages_2eproto_once, nullptr, 0, 5,
+    schemas, file_default_instances, TableStruct_messages_2eproto::offsets,
+    file_level_metadata_messages_2eproto, file_level_enum_descriptors_messages_2eproto,
+    file_level_service_descriptors_messages_2eproto,
 };
-PROTOBUF_ATTRIBUTE_WEAK const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable* descriptor_table_messages_2eproto_getter() {
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_messages_2eproto_getter() {
   return &descriptor_table_messages_2eproto;
 }
 
 // Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY static ::PROTOBUF_NAMESPACE_ID::internal::AddDescriptorsRunner dynamic_init_dummy_messages_2eproto(&descriptor_table_messages_2eproto);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_messages_2eproto(&descriptor_table_messages_2eproto);
 namespace messages {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MSG_ID_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_messages_2eproto);
@@ -154,6 +217,8 @@ bool MSG_ID_IsValid(int value) {
     case 4:
     case 16:
     case 17:
+    case 18:
+    case 32:
       return true;
     default:
       return false;
@@ -185,7 +250,7 @@ bool STATUS_CODE_IsValid(int value) {
 
 class ClientConnectRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<ClientConnectRequest>()._has_bits_);
+  using HasBits = decltype(std::declval<ClientConnectRequest>()._impl_._has_bits_);
   static void set_has_clientid(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
@@ -197,56 +262,63 @@ class ClientConnectRequest::_Internal {
 ClientConnectRequest::ClientConnectRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:messages.ClientConnectRequest)
 }
 ClientConnectRequest::ClientConnectRequest(const ClientConnectRequest& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientConnectRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.token_){}
+    , decltype(_impl_.clientid_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.token_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.token_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_token()) {
-    token_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_token(), 
-      GetArenaForAllocation());
+    _this->_impl_.token_.Set(from._internal_token(), 
+      _this->GetArenaForAllocation());
   }
-  clientid_ = from.clientid_;
+  _this->_impl_.clientid_ = from._impl_.clientid_;
   // @@protoc_insertion_point(copy_constructor:messages.ClientConnectRequest)
 }
 
-inline void ClientConnectRequest::SharedCtor() {
-token_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-clientid_ = int64_t{0};
+inline void ClientConnectRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.token_){}
+    , decltype(_impl_.clientid_){int64_t{0}}
+  };
+  _impl_.token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 ClientConnectRequest::~ClientConnectRequest() {
   // @@protoc_insertion_point(destructor:messages.ClientConnectRequest)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void ClientConnectRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  token_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.token_.Destroy();
 }
 
-void ClientConnectRequest::ArenaDtor(void* object) {
-  ClientConnectRequest* _this = reinterpret_cast< ClientConnectRequest* >(object);
-  (void)_this;
-}
-void ClientConnectRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ClientConnectRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void ClientConnectRequest::Clear() {
@@ -255,27 +327,27 @@ void ClientConnectRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    token_.ClearNonDefaultToEmpty();
+    _impl_.token_.ClearNonDefaultToEmpty();
   }
-  clientid_ = int64_t{0};
-  _has_bits_.Clear();
+  _impl_.clientid_ = int64_t{0};
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClientConnectRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ClientConnectRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional int64 clientId = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
           _Internal::set_has_clientid(&has_bits);
-          clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.clientid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -284,9 +356,9 @@ const char* ClientConnectRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAM
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_token();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "messages.ClientConnectRequest.token"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "messages.ClientConnectRequest.token"));
         } else
           goto handle_unusual;
         continue;
@@ -306,7 +378,7 @@ const char* ClientConnectRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAM
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _has_bits_.Or(has_bits);
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -323,7 +395,7 @@ uint8_t* ClientConnectRequest::_InternalSerialize(
   // optional int64 clientId = 1;
   if (_internal_has_clientid()) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(1, this->_internal_clientid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_clientid(), target);
   }
 
   // optional string token = 2;
@@ -337,7 +409,7 @@ uint8_t* ClientConnectRequest::_InternalSerialize(
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:messages.ClientConnectRequest)
@@ -352,7 +424,7 @@ size_t ClientConnectRequest::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
     // optional string token = 2;
     if (cached_has_bits & 0x00000001u) {
@@ -363,43 +435,39 @@ size_t ClientConnectRequest::ByteSizeLong() const {
 
     // optional int64 clientId = 1;
     if (cached_has_bits & 0x00000002u) {
-      total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64SizePlusOne(this->_internal_clientid());
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_clientid());
     }
 
   }
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientConnectRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     ClientConnectRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientConnectRequest::GetClassData() const { return &_class_data_; }
 
-void ClientConnectRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<ClientConnectRequest *>(to)->MergeFrom(
-      static_cast<const ClientConnectRequest &>(from));
-}
 
-
-void ClientConnectRequest::MergeFrom(const ClientConnectRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:messages.ClientConnectRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void ClientConnectRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientConnectRequest*>(&to_msg);
+  auto& from = static_cast<const ClientConnectRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:messages.ClientConnectRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
+  cached_has_bits = from._impl_._has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_set_token(from._internal_token());
+      _this->_internal_set_token(from._internal_token());
     }
     if (cached_has_bits & 0x00000002u) {
-      clientid_ = from.clientid_;
+      _this->_impl_.clientid_ = from._impl_.clientid_;
     }
-    _has_bits_[0] |= cached_has_bits;
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ClientConnectRequest::CopyFrom(const ClientConnectRequest& from) {
@@ -418,17 +486,16 @@ void ClientConnectRequest::InternalSwap(ClientConnectRequest* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &token_, lhs_arena,
-      &other->token_, rhs_arena
+      &_impl_.token_, lhs_arena,
+      &other->_impl_.token_, rhs_arena
   );
-  swap(clientid_, other->clientid_);
+  swap(_impl_.clientid_, other->_impl_.clientid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ClientConnectRequest::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
       file_level_metadata_messages_2eproto[0]);
 }
@@ -437,7 +504,7 @@ void ClientConnectRequest::InternalSwap(ClientConnectRequest* other) {
 
 class ClientConnectResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<ClientConnectResponse>()._has_bits_);
+  using HasBits = decltype(std::declval<ClientConnectResponse>()._impl_._has_bits_);
   static void set_has_statuscode(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
@@ -446,43 +513,48 @@ class ClientConnectResponse::_Internal {
 ClientConnectResponse::ClientConnectResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:messages.ClientConnectResponse)
 }
 ClientConnectResponse::ClientConnectResponse(const ClientConnectResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientConnectResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.statuscode_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  statuscode_ = from.statuscode_;
+  _this->_impl_.statuscode_ = from._impl_.statuscode_;
   // @@protoc_insertion_point(copy_constructor:messages.ClientConnectResponse)
 }
 
-inline void ClientConnectResponse::SharedCtor() {
-statuscode_ = 0;
+inline void ClientConnectResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.statuscode_){0}
+  };
 }
 
 ClientConnectResponse::~ClientConnectResponse() {
   // @@protoc_insertion_point(destructor:messages.ClientConnectResponse)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void ClientConnectResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void ClientConnectResponse::ArenaDtor(void* object) {
-  ClientConnectResponse* _this = reinterpret_cast< ClientConnectResponse* >(object);
-  (void)_this;
-}
-void ClientConnectResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ClientConnectResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void ClientConnectResponse::Clear() {
@@ -491,17 +563,17 @@ void ClientConnectResponse::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  statuscode_ = 0;
-  _has_bits_.Clear();
+  _impl_.statuscode_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClientConnectResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ClientConnectResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // optional .messages.STATUS_CODE statusCode = 1;
       case 1:
@@ -528,7 +600,7 @@ const char* ClientConnectResponse::_InternalParse(const char* ptr, ::PROTOBUF_NA
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _has_bits_.Or(has_bits);
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -545,12 +617,12 @@ uint8_t* ClientConnectResponse::_InternalSerialize(
   // optional .messages.STATUS_CODE statusCode = 1;
   if (_internal_has_statuscode()) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_statuscode(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:messages.ClientConnectResponse)
@@ -566,38 +638,34 @@ size_t ClientConnectResponse::ByteSizeLong() const {
   (void) cached_has_bits;
 
   // optional .messages.STATUS_CODE statusCode = 1;
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_statuscode());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_statuscode());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientConnectResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     ClientConnectResponse::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientConnectResponse::GetClassData() const { return &_class_data_; }
 
-void ClientConnectResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<ClientConnectResponse *>(to)->MergeFrom(
-      static_cast<const ClientConnectResponse &>(from));
-}
-
 
-void ClientConnectResponse::MergeFrom(const ClientConnectResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:messages.ClientConnectResponse)
-  GOOGLE_DCHECK_NE(&from, this);
+void ClientConnectResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientConnectResponse*>(&to_msg);
+  auto& from = static_cast<const ClientConnectResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:messages.ClientConnectResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from._internal_has_statuscode()) {
-    _internal_set_statuscode(from._internal_statuscode());
+    _this->_internal_set_statuscode(from._internal_statuscode());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ClientConnectResponse::CopyFrom(const ClientConnectResponse& from) {
@@ -614,87 +682,500 @@ bool ClientConnectResponse::IsInitialized() const {
 void ClientConnectResponse::InternalSwap(ClientConnectResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  swap(statuscode_, other->statuscode_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.statuscode_, other->_impl_.statuscode_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ClientConnectResponse::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
       file_level_metadata_messages_2eproto[1]);
 }
 
 // ===================================================================
 
+class Echo::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Echo>()._impl_._has_bits_);
+  static void set_has_text(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+Echo::Echo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:messages.Echo)
+}
+Echo::Echo(const Echo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Echo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_text()) {
+    _this->_impl_.text_.Set(from._internal_text(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:messages.Echo)
+}
+
+inline void Echo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.text_){}
+  };
+  _impl_.text_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.text_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Echo::~Echo() {
+  // @@protoc_insertion_point(destructor:messages.Echo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Echo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.text_.Destroy();
+}
+
+void Echo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Echo::Clear() {
+// @@protoc_insertion_point(message_clear_start:messages.Echo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.text_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Echo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string text = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_text();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "messages.Echo.text"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Echo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:messages.Echo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional string text = 1;
+  if (_internal_has_text()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_text().data(), static_cast<int>(this->_internal_text().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "messages.Echo.text");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_text(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:messages.Echo)
+  return target;
+}
+
+size_t Echo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:messages.Echo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string text = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_text());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Echo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Echo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Echo::GetClassData() const { return &_class_data_; }
+
+
+void Echo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Echo*>(&to_msg);
+  auto& from = static_cast<const Echo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:messages.Echo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_text()) {
+    _this->_internal_set_text(from._internal_text());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Echo::CopyFrom(const Echo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:messages.Echo)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Echo::IsInitialized() const {
+  return true;
+}
+
+void Echo::InternalSwap(Echo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.text_, lhs_arena,
+      &other->_impl_.text_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Echo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[2]);
+}
+
+// ===================================================================
+
+class FrameBatch::_Internal {
+ public:
+};
+
+FrameBatch::FrameBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:messages.FrameBatch)
+}
+FrameBatch::FrameBatch(const FrameBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrameBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_){from._impl_.frames_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:messages.FrameBatch)
+}
+
+inline void FrameBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FrameBatch::~FrameBatch() {
+  // @@protoc_insertion_point(destructor:messages.FrameBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FrameBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frames_.~RepeatedPtrField();
+}
+
+void FrameBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FrameBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:messages.FrameBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frames_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FrameBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes frames = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_frames();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FrameBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:messages.FrameBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes frames = 1;
+  for (int i = 0, n = this->_internal_frames_size(); i < n; i++) {
+    const auto& s = this->_internal_frames(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:messages.FrameBatch)
+  return target;
+}
+
+size_t FrameBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:messages.FrameBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes frames = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.frames_.size());
+  for (int i = 0, n = _impl_.frames_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.frames_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrameBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrameBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrameBatch::GetClassData() const { return &_class_data_; }
+
+
+void FrameBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrameBatch*>(&to_msg);
+  auto& from = static_cast<const FrameBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:messages.FrameBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.frames_.MergeFrom(from._impl_.frames_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FrameBatch::CopyFrom(const FrameBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:messages.FrameBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FrameBatch::IsInitialized() const {
+  return true;
+}
+
+void FrameBatch::InternalSwap(FrameBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.frames_.InternalSwap(&other->_impl_.frames_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FrameBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
+      file_level_metadata_messages_2eproto[3]);
+}
+
+// ===================================================================
+
 class Frame::_Internal {
  public:
-  using HasBits = decltype(std::declval<Frame>()._has_bits_);
+  using HasBits = decltype(std::declval<Frame>()._impl_._has_bits_);
   static void set_has_frameid(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
   static void set_has_data(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_compressed(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
 };
 
 Frame::Frame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  if (!is_message_owned) {
-    RegisterArenaDtor(arena);
-  }
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:messages.Frame)
 }
 Frame::Frame(const Frame& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Frame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.msgid_){}
+    , decltype(_impl_.frameid_){}
+    , decltype(_impl_.compressed_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+    _impl_.data_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (from._internal_has_data()) {
-    data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_data(), 
-      GetArenaForAllocation());
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&msgid_, &from.msgid_,
-    static_cast<size_t>(reinterpret_cast<char*>(&frameid_) -
-    reinterpret_cast<char*>(&msgid_)) + sizeof(frameid_));
+  ::memcpy(&_impl_.msgid_, &from._impl_.msgid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compressed_) -
+    reinterpret_cast<char*>(&_impl_.msgid_)) + sizeof(_impl_.compressed_));
   // @@protoc_insertion_point(copy_constructor:messages.Frame)
 }
 
-inline void Frame::SharedCtor() {
-data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&msgid_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&frameid_) -
-    reinterpret_cast<char*>(&msgid_)) + sizeof(frameid_));
+inline void Frame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.msgid_){0}
+    , decltype(_impl_.frameid_){0}
+    , decltype(_impl_.compressed_){false}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Frame::~Frame() {
   // @@protoc_insertion_point(destructor:messages.Frame)
-  if (GetArenaForAllocation() != nullptr) return;
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 inline void Frame::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.data_.Destroy();
 }
 
-void Frame::ArenaDtor(void* object) {
-  Frame* _this = reinterpret_cast< Frame* >(object);
-  (void)_this;
-}
-void Frame::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Frame::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void Frame::Clear() {
@@ -703,22 +1184,26 @@ void Frame::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    data_.ClearNonDefaultToEmpty();
+    _impl_.data_.ClearNonDefaultToEmpty();
+  }
+  _impl_.msgid_ = 0;
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.frameid_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.compressed_) -
+        reinterpret_cast<char*>(&_impl_.frameid_)) + sizeof(_impl_.compressed_));
   }
-  msgid_ = 0;
-  frameid_ = 0;
-  _has_bits_.Clear();
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Frame::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Frame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .messages.MSG_ID msgId = 1;
       case 1:
@@ -733,7 +1218,7 @@ const char* Frame::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
           _Internal::set_has_frameid(&has_bits);
-          frameid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.frameid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -742,7 +1227,16 @@ const char* Frame::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_data();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool compressed = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_compressed(&has_bits);
+          _impl_.compressed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -763,7 +1257,7 @@ const char* Frame::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _has_bits_.Or(has_bits);
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -780,14 +1274,14 @@ uint8_t* Frame::_InternalSerialize(
   // .messages.MSG_ID msgId = 1;
   if (this->_internal_msgid() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_msgid(), target);
   }
 
   // optional int32 frameId = 2;
   if (_internal_has_frameid()) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_frameid(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_frameid(), target);
   }
 
   // optional bytes data = 3;
@@ -796,8 +1290,14 @@ uint8_t* Frame::_InternalSerialize(
         3, this->_internal_data(), target);
   }
 
+  // optional bool compressed = 4;
+  if (_internal_has_compressed()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_compressed(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:messages.Frame)
@@ -813,7 +1313,7 @@ size_t Frame::ByteSizeLong() const {
   (void) cached_has_bits;
 
   // optional bytes data = 3;
-  cached_has_bits = _has_bits_[0];
+  cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
@@ -823,46 +1323,56 @@ size_t Frame::ByteSizeLong() const {
   // .messages.MSG_ID msgId = 1;
   if (this->_internal_msgid() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_msgid());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_msgid());
   }
 
-  // optional int32 frameId = 2;
-  if (cached_has_bits & 0x00000002u) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32SizePlusOne(this->_internal_frameid());
-  }
+  if (cached_has_bits & 0x00000006u) {
+    // optional int32 frameId = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_frameid());
+    }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+    // optional bool compressed = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Frame::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     Frame::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Frame::GetClassData() const { return &_class_data_; }
 
-void Frame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Frame *>(to)->MergeFrom(
-      static_cast<const Frame &>(from));
-}
-
 
-void Frame::MergeFrom(const Frame& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:messages.Frame)
-  GOOGLE_DCHECK_NE(&from, this);
+void Frame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Frame*>(&to_msg);
+  auto& from = static_cast<const Frame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:messages.Frame)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (from._internal_has_data()) {
-    _internal_set_data(from._internal_data());
+    _this->_internal_set_data(from._internal_data());
   }
   if (from._internal_msgid() != 0) {
-    _internal_set_msgid(from._internal_msgid());
+    _this->_internal_set_msgid(from._internal_msgid());
   }
-  if (from._internal_has_frameid()) {
-    _internal_set_frameid(from._internal_frameid());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.frameid_ = from._impl_.frameid_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.compressed_ = from._impl_.compressed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Frame::CopyFrom(const Frame& from) {
@@ -881,36 +1391,46 @@ void Frame::InternalSwap(Frame* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &data_, lhs_arena,
-      &other->data_, rhs_arena
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Frame, frameid_)
-      + sizeof(Frame::frameid_)
-      - PROTOBUF_FIELD_OFFSET(Frame, msgid_)>(
-          reinterpret_cast<char*>(&msgid_),
-          reinterpret_cast<char*>(&other->msgid_));
+      PROTOBUF_FIELD_OFFSET(Frame, _impl_.compressed_)
+      + sizeof(Frame::_impl_.compressed_)
+      - PROTOBUF_FIELD_OFFSET(Frame, _impl_.msgid_)>(
+          reinterpret_cast<char*>(&_impl_.msgid_),
+          reinterpret_cast<char*>(&other->_impl_.msgid_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Frame::GetMetadata() const {
-  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+  return ::_pbi::AssignDescriptors(
       &descriptor_table_messages_2eproto_getter, &descriptor_table_messages_2eproto_once,
-      file_level_metadata_messages_2eproto[2]);
+      file_level_metadata_messages_2eproto[4]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace messages
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::messages::ClientConnectRequest* Arena::CreateMaybeMessage< ::messages::ClientConnectRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::messages::ClientConnectRequest*
+Arena::CreateMaybeMessage< ::messages::ClientConnectRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::messages::ClientConnectRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::messages::ClientConnectResponse* Arena::CreateMaybeMessage< ::messages::ClientConnectResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::messages::ClientConnectResponse*
+Arena::CreateMaybeMessage< ::messages::ClientConnectResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::messages::ClientConnectResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::messages::Frame* Arena::CreateMaybeMessage< ::messages::Frame >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::messages::Echo*
+Arena::CreateMaybeMessage< ::messages::Echo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::messages::Echo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::messages::FrameBatch*
+Arena::CreateMaybeMessage< ::messages::FrameBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::messages::FrameBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::messages::Frame*
+Arena::CreateMaybeMessage< ::messages::Frame >(Arena* arena) {
   return Arena::CreateMessageInternal< ::messages::Frame >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
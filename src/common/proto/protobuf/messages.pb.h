@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3019000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3019004 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,14 +42,6 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_messages_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
   static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_messages_2eproto;
@@ -61,14 +52,22 @@ extern ClientConnectRequestDefaultTypeInternal _ClientConnectRequest_default_ins
 class ClientConnectResponse;
 struct ClientConnectResponseDefaultTypeInternal;
 extern ClientConnectResponseDefaultTypeInternal _ClientConnectResponse_default_instance_;
+class Echo;
+struct EchoDefaultTypeInternal;
+extern EchoDefaultTypeInternal _Echo_default_instance_;
 class Frame;
 struct FrameDefaultTypeInternal;
 extern FrameDefaultTypeInternal _Frame_default_instance_;
+class FrameBatch;
+struct FrameBatchDefaultTypeInternal;
+extern FrameBatchDefaultTypeInternal _FrameBatch_default_instance_;
 }  // namespace messages
 PROTOBUF_NAMESPACE_OPEN
 template<> ::messages::ClientConnectRequest* Arena::CreateMaybeMessage<::messages::ClientConnectRequest>(Arena*);
 template<> ::messages::ClientConnectResponse* Arena::CreateMaybeMessage<::messages::ClientConnectResponse>(Arena*);
+template<> ::messages::Echo* Arena::CreateMaybeMessage<::messages::Echo>(Arena*);
 template<> ::messages::Frame* Arena::CreateMaybeMessage<::messages::Frame>(Arena*);
+template<> ::messages::FrameBatch* Arena::CreateMaybeMessage<::messages::FrameBatch>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace messages {
 
@@ -80,12 +79,14 @@ enum MSG_ID : int {
   MSG_CLIENT_HEARTBEAT = 4,
   MSG_SERVER_CLOSE = 16,
   MSG_SERVER_DISCONNECT = 17,
+  MSG_SERVER_BATCH = 18,
+  MSG_ECHO = 32,
   MSG_ID_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
   MSG_ID_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MSG_ID_IsValid(int value);
 constexpr MSG_ID MSG_ID_MIN = MSG_CLIENT_CONNECT;
-constexpr MSG_ID MSG_ID_MAX = MSG_SERVER_DISCONNECT;
+constexpr MSG_ID MSG_ID_MAX = MSG_ECHO;
 constexpr int MSG_ID_ARRAYSIZE = MSG_ID_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MSG_ID_descriptor();
@@ -140,7 +141,7 @@ class ClientConnectRequest final :
  public:
   inline ClientConnectRequest() : ClientConnectRequest(nullptr) {}
   ~ClientConnectRequest() override;
-  explicit constexpr ClientConnectRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ClientConnectRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClientConnectRequest(const ClientConnectRequest& from);
   ClientConnectRequest(ClientConnectRequest&& from) noexcept
@@ -215,9 +216,11 @@ class ClientConnectRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ClientConnectRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const ClientConnectRequest& from);
+  void MergeFrom( const ClientConnectRequest& from) {
+    ClientConnectRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -226,10 +229,10 @@ class ClientConnectRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ClientConnectRequest* other);
@@ -242,9 +245,6 @@ class ClientConnectRequest final :
   protected:
   explicit ClientConnectRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -298,10 +298,13 @@ class ClientConnectRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
-  int64_t clientid_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+    int64_t clientid_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
@@ -311,7 +314,7 @@ class ClientConnectResponse final :
  public:
   inline ClientConnectResponse() : ClientConnectResponse(nullptr) {}
   ~ClientConnectResponse() override;
-  explicit constexpr ClientConnectResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR ClientConnectResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClientConnectResponse(const ClientConnectResponse& from);
   ClientConnectResponse(ClientConnectResponse&& from) noexcept
@@ -386,9 +389,11 @@ class ClientConnectResponse final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ClientConnectResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const ClientConnectResponse& from);
+  void MergeFrom( const ClientConnectResponse& from) {
+    ClientConnectResponse::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -397,10 +402,10 @@ class ClientConnectResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ClientConnectResponse* other);
@@ -413,9 +418,6 @@ class ClientConnectResponse final :
   protected:
   explicit ClientConnectResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -450,9 +452,333 @@ class ClientConnectResponse final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  int statuscode_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int statuscode_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Echo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:messages.Echo) */ {
+ public:
+  inline Echo() : Echo(nullptr) {}
+  ~Echo() override;
+  explicit PROTOBUF_CONSTEXPR Echo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Echo(const Echo& from);
+  Echo(Echo&& from) noexcept
+    : Echo() {
+    *this = ::std::move(from);
+  }
+
+  inline Echo& operator=(const Echo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Echo& operator=(Echo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Echo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Echo* internal_default_instance() {
+    return reinterpret_cast<const Echo*>(
+               &_Echo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Echo& a, Echo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Echo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Echo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Echo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Echo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Echo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Echo& from) {
+    Echo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Echo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "messages.Echo";
+  }
+  protected:
+  explicit Echo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTextFieldNumber = 1,
+  };
+  // optional string text = 1;
+  bool has_text() const;
+  private:
+  bool _internal_has_text() const;
+  public:
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // @@protoc_insertion_point(class_scope:messages.Echo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FrameBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:messages.FrameBatch) */ {
+ public:
+  inline FrameBatch() : FrameBatch(nullptr) {}
+  ~FrameBatch() override;
+  explicit PROTOBUF_CONSTEXPR FrameBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FrameBatch(const FrameBatch& from);
+  FrameBatch(FrameBatch&& from) noexcept
+    : FrameBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline FrameBatch& operator=(const FrameBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FrameBatch& operator=(FrameBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FrameBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FrameBatch* internal_default_instance() {
+    return reinterpret_cast<const FrameBatch*>(
+               &_FrameBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(FrameBatch& a, FrameBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FrameBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrameBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FrameBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FrameBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FrameBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrameBatch& from) {
+    FrameBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FrameBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "messages.FrameBatch";
+  }
+  protected:
+  explicit FrameBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFramesFieldNumber = 1,
+  };
+  // repeated bytes frames = 1;
+  int frames_size() const;
+  private:
+  int _internal_frames_size() const;
+  public:
+  void clear_frames();
+  const std::string& frames(int index) const;
+  std::string* mutable_frames(int index);
+  void set_frames(int index, const std::string& value);
+  void set_frames(int index, std::string&& value);
+  void set_frames(int index, const char* value);
+  void set_frames(int index, const void* value, size_t size);
+  std::string* add_frames();
+  void add_frames(const std::string& value);
+  void add_frames(std::string&& value);
+  void add_frames(const char* value);
+  void add_frames(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& frames() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_frames();
+  private:
+  const std::string& _internal_frames(int index) const;
+  std::string* _internal_add_frames();
+  public:
+
+  // @@protoc_insertion_point(class_scope:messages.FrameBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> frames_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // -------------------------------------------------------------------
@@ -462,7 +788,7 @@ class Frame final :
  public:
   inline Frame() : Frame(nullptr) {}
   ~Frame() override;
-  explicit constexpr Frame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR Frame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Frame(const Frame& from);
   Frame(Frame&& from) noexcept
@@ -505,7 +831,7 @@ class Frame final :
                &_Frame_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    4;
 
   friend void swap(Frame& a, Frame& b) {
     a.Swap(&b);
@@ -537,9 +863,11 @@ class Frame final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Frame& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Frame& from);
+  void MergeFrom( const Frame& from) {
+    Frame::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -548,10 +876,10 @@ class Frame final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Frame* other);
@@ -564,9 +892,6 @@ class Frame final :
   protected:
   explicit Frame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
   static const ClassData _class_data_;
@@ -582,6 +907,7 @@ class Frame final :
     kDataFieldNumber = 3,
     kMsgIdFieldNumber = 1,
     kFrameIdFieldNumber = 2,
+    kCompressedFieldNumber = 4,
   };
   // optional bytes data = 3;
   bool has_data() const;
@@ -623,6 +949,19 @@ class Frame final :
   void _internal_set_frameid(int32_t value);
   public:
 
+  // optional bool compressed = 4;
+  bool has_compressed() const;
+  private:
+  bool _internal_has_compressed() const;
+  public:
+  void clear_compressed();
+  bool compressed() const;
+  void set_compressed(bool value);
+  private:
+  bool _internal_compressed() const;
+  void _internal_set_compressed(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:messages.Frame)
  private:
   class _Internal;
@@ -630,11 +969,15 @@ class Frame final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-  int msgid_;
-  int32_t frameid_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    int msgid_;
+    int32_t frameid_;
+    bool compressed_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_2eproto;
 };
 // ===================================================================
@@ -650,26 +993,26 @@ class Frame final :
 
 // optional int64 clientId = 1;
 inline bool ClientConnectRequest::_internal_has_clientid() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool ClientConnectRequest::has_clientid() const {
   return _internal_has_clientid();
 }
 inline void ClientConnectRequest::clear_clientid() {
-  clientid_ = int64_t{0};
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.clientid_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline int64_t ClientConnectRequest::_internal_clientid() const {
-  return clientid_;
+  return _impl_.clientid_;
 }
 inline int64_t ClientConnectRequest::clientid() const {
   // @@protoc_insertion_point(field_get:messages.ClientConnectRequest.clientId)
   return _internal_clientid();
 }
 inline void ClientConnectRequest::_internal_set_clientid(int64_t value) {
-  _has_bits_[0] |= 0x00000002u;
-  clientid_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.clientid_ = value;
 }
 inline void ClientConnectRequest::set_clientid(int64_t value) {
   _internal_set_clientid(value);
@@ -678,15 +1021,15 @@ inline void ClientConnectRequest::set_clientid(int64_t value) {
 
 // optional string token = 2;
 inline bool ClientConnectRequest::_internal_has_token() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool ClientConnectRequest::has_token() const {
   return _internal_has_token();
 }
 inline void ClientConnectRequest::clear_token() {
-  token_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.token_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& ClientConnectRequest::token() const {
   // @@protoc_insertion_point(field_get:messages.ClientConnectRequest.token)
@@ -695,8 +1038,8 @@ inline const std::string& ClientConnectRequest::token() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ClientConnectRequest::set_token(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000001u;
- token_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:messages.ClientConnectRequest.token)
 }
 inline std::string* ClientConnectRequest::mutable_token() {
@@ -705,41 +1048,40 @@ inline std::string* ClientConnectRequest::mutable_token() {
   return _s;
 }
 inline const std::string& ClientConnectRequest::_internal_token() const {
-  return token_.Get();
+  return _impl_.token_.Get();
 }
 inline void ClientConnectRequest::_internal_set_token(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  token_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.token_.Set(value, GetArenaForAllocation());
 }
 inline std::string* ClientConnectRequest::_internal_mutable_token() {
-  _has_bits_[0] |= 0x00000001u;
-  return token_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.token_.Mutable(GetArenaForAllocation());
 }
 inline std::string* ClientConnectRequest::release_token() {
   // @@protoc_insertion_point(field_release:messages.ClientConnectRequest.token)
   if (!_internal_has_token()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  auto* p = token_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.token_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (token_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void ClientConnectRequest::set_allocated_token(std::string* token) {
   if (token != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  token_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), token,
-      GetArenaForAllocation());
+  _impl_.token_.SetAllocated(token, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (token_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    token_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:messages.ClientConnectRequest.token)
@@ -751,26 +1093,26 @@ inline void ClientConnectRequest::set_allocated_token(std::string* token) {
 
 // optional .messages.STATUS_CODE statusCode = 1;
 inline bool ClientConnectResponse::_internal_has_statuscode() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool ClientConnectResponse::has_statuscode() const {
   return _internal_has_statuscode();
 }
 inline void ClientConnectResponse::clear_statuscode() {
-  statuscode_ = 0;
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.statuscode_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline ::messages::STATUS_CODE ClientConnectResponse::_internal_statuscode() const {
-  return static_cast< ::messages::STATUS_CODE >(statuscode_);
+  return static_cast< ::messages::STATUS_CODE >(_impl_.statuscode_);
 }
 inline ::messages::STATUS_CODE ClientConnectResponse::statuscode() const {
   // @@protoc_insertion_point(field_get:messages.ClientConnectResponse.statusCode)
   return _internal_statuscode();
 }
 inline void ClientConnectResponse::_internal_set_statuscode(::messages::STATUS_CODE value) {
-  _has_bits_[0] |= 0x00000001u;
-  statuscode_ = value;
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.statuscode_ = value;
 }
 inline void ClientConnectResponse::set_statuscode(::messages::STATUS_CODE value) {
   _internal_set_statuscode(value);
@@ -779,14 +1121,165 @@ inline void ClientConnectResponse::set_statuscode(::messages::STATUS_CODE value)
 
 // -------------------------------------------------------------------
 
+// Echo
+
+// optional string text = 1;
+inline bool Echo::_internal_has_text() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Echo::has_text() const {
+  return _internal_has_text();
+}
+inline void Echo::clear_text() {
+  _impl_.text_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Echo::text() const {
+  // @@protoc_insertion_point(field_get:messages.Echo.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Echo::set_text(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:messages.Echo.text)
+}
+inline std::string* Echo::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:messages.Echo.text)
+  return _s;
+}
+inline const std::string& Echo::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void Echo::_internal_set_text(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Echo::_internal_mutable_text() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Echo::release_text() {
+  // @@protoc_insertion_point(field_release:messages.Echo.text)
+  if (!_internal_has_text()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.text_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Echo::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:messages.Echo.text)
+}
+
+// -------------------------------------------------------------------
+
+// FrameBatch
+
+// repeated bytes frames = 1;
+inline int FrameBatch::_internal_frames_size() const {
+  return _impl_.frames_.size();
+}
+inline int FrameBatch::frames_size() const {
+  return _internal_frames_size();
+}
+inline void FrameBatch::clear_frames() {
+  _impl_.frames_.Clear();
+}
+inline std::string* FrameBatch::add_frames() {
+  std::string* _s = _internal_add_frames();
+  // @@protoc_insertion_point(field_add_mutable:messages.FrameBatch.frames)
+  return _s;
+}
+inline const std::string& FrameBatch::_internal_frames(int index) const {
+  return _impl_.frames_.Get(index);
+}
+inline const std::string& FrameBatch::frames(int index) const {
+  // @@protoc_insertion_point(field_get:messages.FrameBatch.frames)
+  return _internal_frames(index);
+}
+inline std::string* FrameBatch::mutable_frames(int index) {
+  // @@protoc_insertion_point(field_mutable:messages.FrameBatch.frames)
+  return _impl_.frames_.Mutable(index);
+}
+inline void FrameBatch::set_frames(int index, const std::string& value) {
+  _impl_.frames_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:messages.FrameBatch.frames)
+}
+inline void FrameBatch::set_frames(int index, std::string&& value) {
+  _impl_.frames_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:messages.FrameBatch.frames)
+}
+inline void FrameBatch::set_frames(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.frames_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:messages.FrameBatch.frames)
+}
+inline void FrameBatch::set_frames(int index, const void* value, size_t size) {
+  _impl_.frames_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:messages.FrameBatch.frames)
+}
+inline std::string* FrameBatch::_internal_add_frames() {
+  return _impl_.frames_.Add();
+}
+inline void FrameBatch::add_frames(const std::string& value) {
+  _impl_.frames_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:messages.FrameBatch.frames)
+}
+inline void FrameBatch::add_frames(std::string&& value) {
+  _impl_.frames_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:messages.FrameBatch.frames)
+}
+inline void FrameBatch::add_frames(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.frames_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:messages.FrameBatch.frames)
+}
+inline void FrameBatch::add_frames(const void* value, size_t size) {
+  _impl_.frames_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:messages.FrameBatch.frames)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+FrameBatch::frames() const {
+  // @@protoc_insertion_point(field_list:messages.FrameBatch.frames)
+  return _impl_.frames_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+FrameBatch::mutable_frames() {
+  // @@protoc_insertion_point(field_mutable_list:messages.FrameBatch.frames)
+  return &_impl_.frames_;
+}
+
+// -------------------------------------------------------------------
+
 // Frame
 
 // .messages.MSG_ID msgId = 1;
 inline void Frame::clear_msgid() {
-  msgid_ = 0;
+  _impl_.msgid_ = 0;
 }
 inline ::messages::MSG_ID Frame::_internal_msgid() const {
-  return static_cast< ::messages::MSG_ID >(msgid_);
+  return static_cast< ::messages::MSG_ID >(_impl_.msgid_);
 }
 inline ::messages::MSG_ID Frame::msgid() const {
   // @@protoc_insertion_point(field_get:messages.Frame.msgId)
@@ -794,7 +1287,7 @@ inline ::messages::MSG_ID Frame::msgid() const {
 }
 inline void Frame::_internal_set_msgid(::messages::MSG_ID value) {
   
-  msgid_ = value;
+  _impl_.msgid_ = value;
 }
 inline void Frame::set_msgid(::messages::MSG_ID value) {
   _internal_set_msgid(value);
@@ -803,26 +1296,26 @@ inline void Frame::set_msgid(::messages::MSG_ID value) {
 
 // optional int32 frameId = 2;
 inline bool Frame::_internal_has_frameid() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool Frame::has_frameid() const {
   return _internal_has_frameid();
 }
 inline void Frame::clear_frameid() {
-  frameid_ = 0;
-  _has_bits_[0] &= ~0x00000002u;
+  _impl_.frameid_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
 inline int32_t Frame::_internal_frameid() const {
-  return frameid_;
+  return _impl_.frameid_;
 }
 inline int32_t Frame::frameid() const {
   // @@protoc_insertion_point(field_get:messages.Frame.frameId)
   return _internal_frameid();
 }
 inline void Frame::_internal_set_frameid(int32_t value) {
-  _has_bits_[0] |= 0x00000002u;
-  frameid_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.frameid_ = value;
 }
 inline void Frame::set_frameid(int32_t value) {
   _internal_set_frameid(value);
@@ -831,15 +1324,15 @@ inline void Frame::set_frameid(int32_t value) {
 
 // optional bytes data = 3;
 inline bool Frame::_internal_has_data() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
 inline bool Frame::has_data() const {
   return _internal_has_data();
 }
 inline void Frame::clear_data() {
-  data_.ClearToEmpty();
-  _has_bits_[0] &= ~0x00000001u;
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
 inline const std::string& Frame::data() const {
   // @@protoc_insertion_point(field_get:messages.Frame.data)
@@ -848,8 +1341,8 @@ inline const std::string& Frame::data() const {
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Frame::set_data(ArgT0&& arg0, ArgT... args) {
- _has_bits_[0] |= 0x00000001u;
- data_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:messages.Frame.data)
 }
 inline std::string* Frame::mutable_data() {
@@ -858,46 +1351,73 @@ inline std::string* Frame::mutable_data() {
   return _s;
 }
 inline const std::string& Frame::_internal_data() const {
-  return data_.Get();
+  return _impl_.data_.Get();
 }
 inline void Frame::_internal_set_data(const std::string& value) {
-  _has_bits_[0] |= 0x00000001u;
-  data_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Frame::_internal_mutable_data() {
-  _has_bits_[0] |= 0x00000001u;
-  return data_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Frame::release_data() {
   // @@protoc_insertion_point(field_release:messages.Frame.data)
   if (!_internal_has_data()) {
     return nullptr;
   }
-  _has_bits_[0] &= ~0x00000001u;
-  auto* p = data_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (data_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
 inline void Frame::set_allocated_data(std::string* data) {
   if (data != nullptr) {
-    _has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
-      GetArenaForAllocation());
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (data_.IsDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited())) {
-    data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), "", GetArenaForAllocation());
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:messages.Frame.data)
 }
 
+// optional bool compressed = 4;
+inline bool Frame::_internal_has_compressed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Frame::has_compressed() const {
+  return _internal_has_compressed();
+}
+inline void Frame::clear_compressed() {
+  _impl_.compressed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Frame::_internal_compressed() const {
+  return _impl_.compressed_;
+}
+inline bool Frame::compressed() const {
+  // @@protoc_insertion_point(field_get:messages.Frame.compressed)
+  return _internal_compressed();
+}
+inline void Frame::_internal_set_compressed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.compressed_ = value;
+}
+inline void Frame::set_compressed(bool value) {
+  _internal_set_compressed(value);
+  // @@protoc_insertion_point(field_set:messages.Frame.compressed)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -905,6 +1425,10 @@ inline void Frame::set_allocated_data(std::string* data) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -5,15 +5,48 @@
 
 #include "common/logger/LoggerHandler.hpp"
 
-#define _FILE                                                       \
-    (strrchr(__FILE__, '/')           ? strrchr(__FILE__, '/') + 1  \
-            : strrchr(__FILE__, '\\') ? strrchr(__FILE__, '\\') + 1 \
-                                      : __FILE__)
-
-#define logDebug() (LoggerHandler::getInstance().print(LogLevel::Debug, _FILE, __LINE__))
-#define logInfo() (LoggerHandler::getInstance().print(LogLevel::Info, _FILE, __LINE__))
-#define logWarning() (LoggerHandler::getInstance().print(LogLevel::Warning, _FILE, __LINE__))
-#define logError() (LoggerHandler::getInstance().print(LogLevel::Error, _FILE, __LINE__))
+// Log calls below this level are compiled out: 0 debug, 1 info, 2 warning, 3 error.
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL 0
+#endif
+
+constexpr const char* logFileName(const char* path)
+{
+    const char* file = path;
+    for (; *path; ++path) {
+        if (*path == '/' || *path == '\\')
+            file = path + 1;
+    }
+    return file;
+}
+
+#define _FILE                                               \
+    ([]() {                                                 \
+        constexpr const char* file = logFileName(__FILE__); \
+        return file;                                        \
+    }())
+
+// Nothing after `<<` is evaluated unless the level is enabled.
+#define _LOG(level)                                                 \
+    ((level) < LOG_MIN_LEVEL || !LoggerHandler::isEnabled(level))   \
+        ? (void)0                                                   \
+        : LogVoidify() & LoggerHandler::getInstance().print(level, _FILE, __LINE__)
+
+#define logDebug() _LOG(LogLevel::Debug)
+#define logInfo() _LOG(LogLevel::Info)
+#define logWarning() _LOG(LogLevel::Warning)
+#define logError() _LOG(LogLevel::Error)
+
+// Binary structured log. format must be a string literal with {} for each
+// argument; it is registered once per call site and only the arguments are
+// encoded per call. Rendered as text by the console and text file loggers.
+#define logEvent(level, format, ...)                                                                \
+    do {                                                                                            \
+        if ((level) >= LOG_MIN_LEVEL && LoggerHandler::isEnabled(level)) {                          \
+            static const u32 _logFormatId = binlog::registerFormat(level, _FILE, __LINE__, format); \
+            LoggerHandler::getInstance().postEvent(level, _logFormatId __VA_OPT__(, ) __VA_ARGS__);  \
+        }                                                                                           \
+    } while (false)
 
 #define logTrace(s)                          \
     do {                                     \
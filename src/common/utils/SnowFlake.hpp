@@ -1,10 +1,13 @@
 #ifndef SNOWFLAKE_HPP_
 #define SNOWFLAKE_HPP_
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <mutex>
+#include <iterator>
 #include <stdexcept>
+#include <utility>
 
 class snowflake_nonlock {
 public:
@@ -16,6 +19,82 @@ public:
     }
 };
 
+/*
+ * A block of ids handed out by snowflake::reserve. Within a millisecond the
+ * ids are consecutive integers; when the generator's sequence range runs out
+ * the block continues at sequence 0 of the next millisecond.
+ */
+class snowflake_range {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int64_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int64_t*;
+        using reference = int64_t;
+
+        iterator() = default;
+        iterator(int64_t id, int64_t index, int64_t sequence_mask, int64_t millisecond_step)
+            : id_(id)
+            , index_(index)
+            , sequence_mask_(sequence_mask)
+            , millisecond_step_(millisecond_step)
+        {
+        }
+
+        int64_t operator*() const { return id_; }
+
+        iterator& operator++()
+        {
+            if ((id_ & sequence_mask_) == sequence_mask_) {
+                id_ += millisecond_step_ - sequence_mask_;
+            } else {
+                ++id_;
+            }
+            ++index_;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const iterator& other) const { return index_ == other.index_; }
+
+    private:
+        int64_t id_ = 0;
+        int64_t index_ = 0;
+        int64_t sequence_mask_ = 0;
+        int64_t millisecond_step_ = 0;
+    };
+
+    snowflake_range() = default;
+    snowflake_range(int64_t first, int64_t count, int64_t sequence_mask, int64_t millisecond_step)
+        : first_(first)
+        , count_(count)
+        , sequence_mask_(sequence_mask)
+        , millisecond_step_(millisecond_step)
+    {
+    }
+
+    iterator begin() const { return { first_, 0, sequence_mask_, millisecond_step_ }; }
+    iterator end() const { return { 0, count_, sequence_mask_, millisecond_step_ }; }
+
+    int64_t front() const { return first_; }
+    std::size_t size() const { return static_cast<std::size_t>(count_); }
+    bool empty() const { return count_ == 0; }
+
+private:
+    int64_t first_ = 0;
+    int64_t count_ = 0;
+    int64_t sequence_mask_ = 0;
+    int64_t millisecond_step_ = 0;
+};
+
 template <typename Lock = snowflake_nonlock>
 class snowflake {
     using lock_type = Lock;
@@ -29,6 +108,11 @@ class snowflake {
     static constexpr int64_t TIMESTAMP_LEFT_SHIFT = SEQUENCE_BITS + WORKER_ID_BITS + DATACENTER_ID_BITS;
     static constexpr int64_t SEQUENCE_MASK = (1 << SEQUENCE_BITS) - 1;
 
+    // How far reserve lets a generator's clock run ahead of the wall clock.
+    // Only the wall clock survives a restart, ids borrowed far ahead could be
+    // handed out a second time.
+    static constexpr int64_t MAX_BORROW_MS = 4L;
+
     using time_point = std::chrono::time_point<std::chrono::steady_clock>;
 
     time_point start_time_point_ = std::chrono::steady_clock::now();
@@ -39,6 +123,8 @@ class snowflake {
     int64_t tewpoch_ = 687888001020L;
     int64_t datacenterid_ = 0;
     int64_t sequence_ = 0;
+    int64_t sequence_mask_ = SEQUENCE_MASK;
+    int64_t sequence_base_ = 0;
     lock_type lock_;
 
 public:
@@ -48,7 +134,9 @@ public:
 
     snowflake& operator=(const snowflake&) = delete;
 
-    void init(int64_t workerid, int64_t datacenterid, int64_t twepoch)
+    // shard_bits of the sequence field are fixed to shard, so up to
+    // 2^shard_bits generators can share one worker id without coordinating
+    void init(int64_t workerid, int64_t datacenterid, int64_t twepoch, int64_t shard = 0, int64_t shard_bits = 0)
     {
         if (workerid > MAX_WORKER_ID || workerid < 0) {
             throw std::runtime_error("worker Id can't be greater than 31 or less than 0");
@@ -58,48 +146,97 @@ public:
             throw std::runtime_error("datacenter Id can't be greater than 31 or less than 0");
         }
 
+        if (shard_bits < 0 || shard_bits >= SEQUENCE_BITS || shard < 0 || shard >= (int64_t(1) << shard_bits)) {
+            throw std::runtime_error("shard doesn't fit in the sequence bits");
+        }
+
         workerid_ = workerid;
         datacenterid_ = datacenterid;
         tewpoch_ = twepoch;
+        sequence_mask_ = SEQUENCE_MASK >> shard_bits;
+        sequence_base_ = shard << (SEQUENCE_BITS - shard_bits);
     }
 
     int64_t nextid()
     {
         std::lock_guard<lock_type> lock(lock_);
+        auto [timestamp, sequence] = advance(1);
+        return make_id(timestamp, sequence);
+    }
+
+    // Hands out up to count ids in one step without waiting. A block larger
+    // than what is left of the current millisecond borrows the following
+    // ones, up to MAX_BORROW_MS ahead of the clock; the range is cut short
+    // there, empty if the window is used up, and the caller asks again later.
+    snowflake_range reserve(int64_t count)
+    {
+        std::lock_guard<lock_type> lock(lock_);
+        count = std::min(count, available());
+        if (count <= 0) {
+            return {};
+        }
+
+        auto [timestamp, sequence] = advance(count);
+        return { make_id(timestamp, sequence), count, sequence_mask_, int64_t(1) << TIMESTAMP_LEFT_SHIFT };
+    }
+
+    // the most a single reserve call can return
+    int64_t max_reserve() const noexcept
+    {
+        return (MAX_BORROW_MS + 1) * (sequence_mask_ + 1);
+    }
+
+private:
+    // Moves past count sequence numbers and returns the timestamp and
+    // sequence of the first one. Out of sequence numbers it borrows the next
+    // millisecond, it never waits since callers may be I/O threads; the
+    // clock catches up once the burst is over. nextid is not held to
+    // MAX_BORROW_MS, a thread kept above the shard's rate runs ahead of the
+    // wall clock by the excess.
+    std::pair<int64_t, int64_t> advance(int64_t count)
+    {
         // std::chrono::steady_clock  cannot decrease as physical time moves forward
         auto timestamp = millsecond();
-        if (last_timestamp_ == timestamp) {
-            sequence_ = (sequence_ + 1) & SEQUENCE_MASK;
-            if (sequence_ == 0) {
-                timestamp = wait_next_millis(last_timestamp_);
+        int64_t sequence = 0;
+        if (timestamp <= last_timestamp_) {
+            timestamp = last_timestamp_;
+            sequence = sequence_ + 1;
+            if (sequence > sequence_mask_) {
+                ++timestamp;
+                sequence = 0;
             }
-        } else {
-            sequence_ = 0;
         }
 
-        last_timestamp_ = timestamp;
+        int64_t last = sequence + count - 1;
+        last_timestamp_ = timestamp + last / (sequence_mask_ + 1);
+        sequence_ = last % (sequence_mask_ + 1);
+        return { timestamp, sequence };
+    }
+
+    // sequence numbers left before the clock would pass now + MAX_BORROW_MS
+    int64_t available() const noexcept
+    {
+        const int64_t now = millsecond();
+        if (last_timestamp_ < now) {
+            return max_reserve();
+        }
+        return (now + MAX_BORROW_MS - last_timestamp_) * (sequence_mask_ + 1) + (sequence_mask_ - sequence_);
+    }
 
+    int64_t make_id(int64_t timestamp, int64_t sequence) const noexcept
+    {
         return ((timestamp - tewpoch_) << TIMESTAMP_LEFT_SHIFT)
             | (datacenterid_ << DATACENTER_ID_SHIFT)
             | (workerid_ << WORKER_ID_SHIFT)
-            | sequence_;
+            | sequence_base_
+            | sequence;
     }
 
-private:
     int64_t millsecond() const noexcept
     {
         auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time_point_);
         return start_millsecond_ + diff.count();
     }
-
-    int64_t wait_next_millis(int64_t last) const noexcept
-    {
-        auto timestamp = millsecond();
-        while (timestamp <= last) {
-            timestamp = millsecond();
-        }
-        return timestamp;
-    }
 };
 
 #endif /* SNOWFLAKE_HPP_ */
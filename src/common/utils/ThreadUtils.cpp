@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "common/utils/ThreadUtils.hpp"
+
+namespace utils
+{
+
+bool ThreadPlacement::apply() const
+{
+    if (!name.empty()) {
+        setThreadName(name);
+    }
+    return cpus.empty() || setThreadAffinity(cpus);
+}
+
+std::vector<u32> parseCpuList(const std::string &list)
+{
+    std::vector<u32> cpus;
+    std::stringstream stream(list);
+    std::string part;
+
+    while (std::getline(stream, part, ',')) {
+        try {
+            auto dash = part.find('-');
+            unsigned long long first = std::stoull(part.substr(0, dash));
+            unsigned long long last = dash == std::string::npos ? first : std::stoull(part.substr(dash + 1));
+            // no thread can be pinned past CPU_SETSIZE, the rest of a range is dropped
+            last = std::min<unsigned long long>(last, CPU_SETSIZE - 1);
+            for (auto cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(static_cast<u32>(cpu));
+            }
+        } catch (const std::exception &) {
+            // skip empty or malformed ranges
+        }
+    }
+
+    return cpus;
+}
+
+std::vector<u32> numaNodeCpus(int node)
+{
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    std::getline(file, list);
+
+    return parseCpuList(list);
+}
+
+std::vector<u32> onlineCpus()
+{
+    std::ifstream file("/sys/devices/system/cpu/online");
+    std::string list;
+    std::getline(file, list);
+
+    auto cpus = parseCpuList(list);
+    if (cpus.empty()) {
+        for (u32 cpu = 0; cpu < std::thread::hardware_concurrency(); ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+void setThreadName(const std::string &name)
+{
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+}
+
+bool setThreadAffinity(const std::vector<u32> &cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (u32 cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+} // namespace utils
@@ -0,0 +1,39 @@
+#ifndef THREADUTILS_HPP_
+#define THREADUTILS_HPP_
+
+#include <string>
+#include <vector>
+
+#include "common/utils/IntTypes.hpp"
+
+namespace utils {
+
+// Where a long-lived thread should run. Applied by the thread itself before it
+// allocates anything, so its per-thread state is first touched on its own
+// NUMA node.
+struct ThreadPlacement {
+    std::string name;
+    // empty means the thread may run anywhere
+    std::vector<u32> cpus;
+
+    // false if the thread could not be pinned
+    bool apply() const;
+};
+
+// Parses a Linux style CPU list such as "0-3,8,10-11". CPUs at or past
+// CPU_SETSIZE can't be pinned to and are left out.
+std::vector<u32> parseCpuList(const std::string &list);
+
+// CPUs belonging to a NUMA node, empty if the node is unknown.
+std::vector<u32> numaNodeCpus(int node);
+
+std::vector<u32> onlineCpus();
+
+// Names the calling thread, truncated to the 15 characters Linux keeps.
+void setThreadName(const std::string &name);
+
+bool setThreadAffinity(const std::vector<u32> &cpus);
+
+} // namespace utils
+
+#endif // THREADUTILS_HPP_
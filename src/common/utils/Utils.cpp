@@ -1,3 +1,4 @@
+#include <ctime>
 #include <iomanip>
 #include <regex>
 #include <sstream>
@@ -26,4 +27,40 @@ std::string getCurrentTime(const char *format)
     return sstream.str();
 }
 
+std::string_view formatTimestamp(std::chrono::system_clock::time_point time, TimePrecision precision)
+{
+    constexpr std::size_t DATE_LENGTH = 19; // "YYYY-mm-dd HH:MM:SS"
+
+    thread_local std::time_t cachedSecond = -1;
+    thread_local char buffer[32];
+
+    auto micros = std::chrono::floor<std::chrono::microseconds>(time.time_since_epoch()).count();
+    auto seconds = std::chrono::floor<std::chrono::seconds>(time.time_since_epoch()).count();
+    std::time_t second = static_cast<std::time_t>(seconds);
+
+    if (second != cachedSecond) {
+        std::tm tm;
+        localtime_r(&second, &tm);
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &tm);
+        cachedSecond = second;
+    }
+
+    if (precision == TimePrecision::Seconds)
+        return { buffer, DATE_LENGTH };
+
+    u32 fraction = static_cast<u32>(micros - seconds * 1000000);
+    std::size_t digits = 6;
+    if (precision == TimePrecision::Milliseconds) {
+        fraction /= 1000;
+        digits = 3;
+    }
+
+    buffer[DATE_LENGTH] = '.';
+    for (std::size_t i = digits; i > 0; --i) {
+        buffer[DATE_LENGTH + i] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
+    return { buffer, DATE_LENGTH + 1 + digits };
+}
+
 } // namespace utils
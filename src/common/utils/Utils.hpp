@@ -1,9 +1,13 @@
 #ifndef UTILS_HPP_
 #define UTILS_HPP_
 
+#include <chrono>
 #include <sstream>
+#include <string_view>
 #include <vector>
 
+#include "common/utils/IntTypes.hpp"
+
 namespace utils {
 
 template <typename T>
@@ -28,6 +32,18 @@ std::string makeString(Args&&... args)
 
 std::string getCurrentTime(const char* format);
 
+enum class TimePrecision : u8 {
+    Seconds,
+    Milliseconds,
+    Microseconds,
+};
+
+// "%Y-%m-%d %H:%M:%S" in local time, plus ".mmm" or ".uuuuuu". The date part
+// is cached per thread and only reformatted when the second changes. The
+// view points into a thread_local buffer and stays valid until the next
+// call on the same thread.
+std::string_view formatTimestamp(std::chrono::system_clock::time_point time, TimePrecision precision = TimePrecision::Seconds);
+
 } // namespace utils
 
 #endif // UTILS_HPP_
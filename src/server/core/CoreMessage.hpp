@@ -1,17 +1,47 @@
 #ifndef COREMESSAGE_HPP_
 #define COREMESSAGE_HPP_
 
-#include <string>
+#include <cstddef>
+
+#include "common/utils/IntTypes.hpp"
+#include "server/core/MessagePool.hpp"
+#include "server/core/ServiceId.hpp"
+
+// One entry per CoreMessage subclass, indexes the services' dispatch tables.
+enum class MessageType : u16 {
+    Echo,
+
+    Count
+};
+
+constexpr std::size_t MESSAGE_TYPE_COUNT = static_cast<std::size_t>(MessageType::Count);
 
 class CoreMessage {
 public:
-    CoreMessage() = default;
-    CoreMessage(std::string sender, std::string receiver)
-        : sender(sender)
+    CoreMessage(MessageType type, ServiceId sender, ServiceId receiver)
+        : type(type)
+        , sender(sender)
         , receiver(receiver) {};
     virtual ~CoreMessage() { }
-    std::string sender;
-    std::string receiver;
+
+    // Subclasses are recycled through the message pool; the virtual destructor
+    // makes the sized delete see the size of the most derived type.
+    static void* operator new(std::size_t size) { return MessagePool::allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { MessagePool::deallocate(ptr, size); }
+
+    MessageType type;
+    ServiceId sender;
+    ServiceId receiver;
+};
+
+// Base for concrete messages, carries the type tag as a compile-time constant.
+template <MessageType Type>
+class TypedMessage : public CoreMessage {
+public:
+    static constexpr MessageType TYPE = Type;
+
+    TypedMessage(ServiceId sender, ServiceId receiver)
+        : CoreMessage(Type, sender, receiver) {};
 };
 
-#endif /* COREMESSAGE_HPP_ */
\ No newline at end of file
+#endif /* COREMESSAGE_HPP_ */
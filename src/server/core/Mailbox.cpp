@@ -0,0 +1,91 @@
+#include "server/core/Mailbox.hpp"
+
+#include <asio/post.hpp>
+#include <asio/redirect_error.hpp>
+#include <asio/use_awaitable.hpp>
+
+#include "server/core/ServerConfig.hpp"
+
+Mailbox::Mailbox(ThreadPool& threadPool, MailboxMode mode, Handler handler)
+    : m_threadPool(threadPool)
+    , m_mode(mode)
+    , m_handler(std::move(handler))
+    , m_strand(asio::make_strand(threadPool.getIoContext()))
+    , m_signal(m_strand, asio::steady_timer::time_point::max())
+{
+}
+
+void Mailbox::post(std::unique_ptr<CoreMessage> message)
+{
+    m_queue.enqueue(std::move(message));
+    if (m_mode == MailboxMode::Dispatch) {
+        schedule();
+    } else {
+        notifyReceiver();
+    }
+}
+
+asio::awaitable<std::unique_ptr<CoreMessage>> Mailbox::receive()
+{
+    std::unique_ptr<CoreMessage> message;
+    while (!m_queue.try_dequeue(message)) {
+        if (m_closed.load(std::memory_order_acquire)) {
+            co_return nullptr;
+        }
+
+        // the wakeup runs on our strand, so it can't land between the
+        // dequeue attempt above and the wait below
+        asio::error_code ec;
+        co_await m_signal.async_wait(asio::redirect_error(asio::use_awaitable, ec));
+    }
+    co_return message;
+}
+
+void Mailbox::close()
+{
+    m_closed.store(true, std::memory_order_release);
+    notifyReceiver();
+}
+
+void Mailbox::notifyReceiver()
+{
+    if (!m_receiverNotified.exchange(true, std::memory_order_acq_rel)) {
+        asio::post(m_strand, [this]() {
+            m_receiverNotified.store(false, std::memory_order_release);
+            m_signal.cancel();
+        });
+    }
+}
+
+void Mailbox::schedule()
+{
+    if (!m_scheduled.exchange(true)) {
+        m_threadPool.post([this]() { drain(); });
+    }
+}
+
+void Mailbox::drain()
+{
+    const std::size_t maxBatch = ServerConfig::bus_batch_size > 0 ? ServerConfig::bus_batch_size : 1;
+    if (m_batch.size() < maxBatch) {
+        m_batch.resize(maxBatch);
+    }
+
+    std::size_t count = m_queue.try_dequeue_bulk(m_batch.begin(), maxBatch);
+    for (std::size_t i = 0; i < count; ++i) {
+        m_handler(std::move(m_batch[i]));
+    }
+
+    // a full batch means there is likely more, requeue behind other work
+    if (count == maxBatch) {
+        m_threadPool.post([this]() { drain(); });
+        return;
+    }
+
+    // a producer may have enqueued after our dequeue but seen m_scheduled
+    // still set, so look again once the flag is cleared
+    m_scheduled.store(false);
+    if (m_queue.size_approx() > 0) {
+        schedule();
+    }
+}
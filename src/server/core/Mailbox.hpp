@@ -0,0 +1,74 @@
+#ifndef MAILBOX_HPP_
+#define MAILBOX_HPP_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <asio/awaitable.hpp>
+#include <asio/io_context.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/strand.hpp>
+#include <concurrentqueue.h>
+
+#include "common/utils/IntTypes.hpp"
+#include "server/core/CoreMessage.hpp"
+#include "server/core/ThreadPool.hpp"
+
+enum class MailboxMode : u8 {
+    // a drain task on the pool hands messages to the owner's handler
+    Dispatch,
+    // the owner pulls messages itself with co_await receive()
+    Receive,
+};
+
+/*
+ * Lock-free per-service message queue.
+ * In Dispatch mode posting schedules a single drain task on the thread pool;
+ * the drain hands messages to the owner in batches, so each service consumes
+ * on its own and no thread waits on an empty mailbox.
+ * In Receive mode the owner runs a consumer coroutine on the mailbox strand
+ * and suspends in receive() while the queue is empty.
+ */
+class Mailbox {
+public:
+    using Handler = std::function<void(std::unique_ptr<CoreMessage>)>;
+    using Executor = asio::strand<asio::io_context::executor_type>;
+
+    Mailbox(ThreadPool& threadPool, MailboxMode mode, Handler handler = {});
+
+    void post(std::unique_ptr<CoreMessage> message);
+
+    // Must be awaited from a coroutine running on getExecutor(). Returns
+    // nullptr once the mailbox is closed and empty.
+    asio::awaitable<std::unique_ptr<CoreMessage>> receive();
+    void close();
+
+    Executor getExecutor() const { return m_strand; }
+
+private:
+    void schedule();
+    void drain();
+
+    void notifyReceiver();
+
+private:
+    ThreadPool& m_threadPool;
+    MailboxMode m_mode;
+    Handler m_handler;
+
+    moodycamel::ConcurrentQueue<std::unique_ptr<CoreMessage>> m_queue;
+    std::atomic<bool> m_scheduled = false;
+
+    Executor m_strand;
+    // never expires on its own, cancelled to wake the receiver
+    asio::steady_timer m_signal;
+    std::atomic<bool> m_receiverNotified = false;
+    std::atomic<bool> m_closed = false;
+
+    // only touched by the drain task, which never runs twice at once
+    std::vector<std::unique_ptr<CoreMessage>> m_batch;
+};
+
+#endif /* MAILBOX_HPP_ */
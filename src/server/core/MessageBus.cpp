@@ -10,23 +10,10 @@ MessageBus::MessageBus(ServicesMap& services)
 
 void MessageBus::send(std::unique_ptr<CoreMessage> message)
 {
-    m_queue.enqueue(std::move(message));
-    m_messageCounter.fetch_add(1);
-}
-
-void MessageBus::processOne()
-{
-    if (m_messageCounter.load() == 0) {
+    auto index = static_cast<std::size_t>(message->receiver);
+    if (index >= m_services.size() || !m_services[index]) {
+        logWarning() << "MessageBus: no service registered for id" << index;
         return;
     }
-
-    std::unique_ptr<CoreMessage> message;
-    if (m_queue.try_dequeue(message)) {
-        auto it = m_services.find(message->receiver);
-        if (it != m_services.end()) {
-            logDebug() << "MessageBus: sending message to " << message->receiver;
-            it->second->onMessage(std::move(message));
-        }
-        m_messageCounter.fetch_sub(1);
-    }
+    m_services[index]->getMailbox().post(std::move(message));
 }
@@ -1,19 +1,17 @@
 #ifndef MESSAGEBUS_HPP_
 #define MESSAGEBUS_HPP_
 
+#include <array>
 #include <memory>
-#include <unordered_map>
-
-#include <concurrentqueue.h>
 
 #include "common/utils/IntTypes.hpp"
 #include "server/core/CoreMessage.hpp"
+#include "server/core/Mailbox.hpp"
+#include "server/core/ServiceId.hpp"
 #include "server/services/Service.hpp"
 
-using namespace moodycamel;
-
 class MessageBus : public std::enable_shared_from_this<MessageBus> {
-    using ServicesMap = std::unordered_map<std::string, std::shared_ptr<Service>>;
+    using ServicesMap = std::array<std::shared_ptr<Service>, SERVICE_COUNT>;
 
 public:
     MessageBus(ServicesMap& services);
@@ -27,15 +25,11 @@ private:
     MessageBus& operator=(MessageBus&&) = delete;
 
 public:
+    // Posts straight into the receiver's mailbox, indexed by its ServiceId.
     void send(std::unique_ptr<CoreMessage> message);
-    void processOne();
 
 private:
     ServicesMap& m_services;
-    ConcurrentQueue<std::unique_ptr<CoreMessage>> m_queue;
-
-private:
-    std::atomic<u64> m_messageCounter = 0;
 };
 
 #endif /* MESSAGEBUS_HPP_ */
@@ -0,0 +1,162 @@
+#include "server/core/MessagePool.hpp"
+
+#include <array>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t SIZE_CLASSES[] = { 64, 128, 256, 512 };
+constexpr std::size_t CLASS_COUNT = std::size(SIZE_CLASSES);
+constexpr std::size_t MAX_POOLED_SIZE = SIZE_CLASSES[CLASS_COUNT - 1];
+
+constexpr std::size_t SLAB_SIZE = 64 * 1024;
+// blocks move between threads and the depot in batches of this size
+constexpr std::size_t TRANSFER_BATCH = 128;
+constexpr std::size_t LOCAL_HIGH_WATER = 2 * TRANSFER_BATCH;
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+struct Batch {
+    FreeBlock* head;
+    std::size_t count;
+};
+
+std::size_t classIndex(std::size_t size)
+{
+    std::size_t index = 0;
+    while (SIZE_CLASSES[index] < size) {
+        ++index;
+    }
+    return index;
+}
+
+class Depot {
+public:
+    bool take(std::size_t index, Batch& batch)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& batches = m_batches[index];
+        if (batches.empty()) {
+            return false;
+        }
+        batch = batches.back();
+        batches.pop_back();
+        return true;
+    }
+
+    void give(std::size_t index, Batch batch)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_batches[index].push_back(batch);
+    }
+
+private:
+    std::mutex m_mutex;
+    std::array<std::vector<Batch>, CLASS_COUNT> m_batches;
+};
+
+Depot& depot()
+{
+    // intentionally leaked, thread caches flush into it during shutdown
+    static Depot* instance = new Depot;
+    return *instance;
+}
+
+class ThreadCache {
+public:
+    ~ThreadCache()
+    {
+        for (std::size_t i = 0; i < CLASS_COUNT; ++i) {
+            if (m_lists[i].count > 0) {
+                depot().give(i, m_lists[i]);
+            }
+        }
+    }
+
+    void* allocate(std::size_t index)
+    {
+        auto& list = m_lists[index];
+        if (!list.head && !depot().take(index, list)) {
+            carveSlab(index);
+        }
+
+        FreeBlock* block = list.head;
+        list.head = block->next;
+        --list.count;
+        return block;
+    }
+
+    void deallocate(void* ptr, std::size_t index)
+    {
+        auto& list = m_lists[index];
+        auto* block = static_cast<FreeBlock*>(ptr);
+        block->next = list.head;
+        list.head = block;
+
+        if (++list.count > LOCAL_HIGH_WATER) {
+            releaseBatch(index);
+        }
+    }
+
+private:
+    void carveSlab(std::size_t index)
+    {
+        const std::size_t blockSize = SIZE_CLASSES[index];
+        auto* slab = static_cast<char*>(::operator new(SLAB_SIZE));
+
+        auto& list = m_lists[index];
+        for (std::size_t offset = 0; offset + blockSize <= SLAB_SIZE; offset += blockSize) {
+            auto* block = reinterpret_cast<FreeBlock*>(slab + offset);
+            block->next = list.head;
+            list.head = block;
+            ++list.count;
+        }
+    }
+
+    void releaseBatch(std::size_t index)
+    {
+        auto& list = m_lists[index];
+        Batch batch { list.head, TRANSFER_BATCH };
+
+        FreeBlock* last = list.head;
+        for (std::size_t i = 1; i < TRANSFER_BATCH; ++i) {
+            last = last->next;
+        }
+        list.head = last->next;
+        list.count -= TRANSFER_BATCH;
+        last->next = nullptr;
+
+        depot().give(index, batch);
+    }
+
+private:
+    std::array<Batch, CLASS_COUNT> m_lists {};
+};
+
+thread_local ThreadCache t_cache;
+
+} // namespace
+
+void* MessagePool::allocate(std::size_t size)
+{
+    if (size > MAX_POOLED_SIZE) {
+        return ::operator new(size);
+    }
+    return t_cache.allocate(classIndex(size));
+}
+
+void MessagePool::deallocate(void* ptr, std::size_t size) noexcept
+{
+    if (!ptr) {
+        return;
+    }
+    if (size > MAX_POOLED_SIZE) {
+        ::operator delete(ptr);
+        return;
+    }
+    t_cache.deallocate(ptr, classIndex(size));
+}
@@ -0,0 +1,20 @@
+#ifndef MESSAGEPOOL_HPP_
+#define MESSAGEPOOL_HPP_
+
+#include <cstddef>
+
+/*
+ * Slab allocator for bus messages.
+ * Blocks come in a few fixed size classes carved from large slabs; each
+ * thread keeps its own free lists, so allocating and recycling a message is
+ * a couple of pointer moves. Threads that free more than they allocate (the
+ * usual consumer side) hand surplus blocks back in batches through a shared
+ * depot. Slab memory is kept for the lifetime of the process.
+ */
+class MessagePool {
+public:
+    static void* allocate(std::size_t size);
+    static void deallocate(void* ptr, std::size_t size) noexcept;
+};
+
+#endif /* MESSAGEPOOL_HPP_ */
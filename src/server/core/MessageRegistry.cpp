@@ -0,0 +1,16 @@
+#include "server/core/MessageRegistry.hpp"
+
+std::unique_ptr<CoreMessage> MessageRegistry::decode(ClientInfoPtr client, const messages::Frame& frame) const
+{
+    auto id = static_cast<std::size_t>(frame.msgid());
+    if (id >= m_entries.size() || !m_entries[id].decode) {
+        return nullptr;
+    }
+
+    const Entry& entry = m_entries[id];
+    auto message = entry.decode(std::move(client), frame);
+    if (message) {
+        message->receiver = entry.target;
+    }
+    return message;
+}
@@ -0,0 +1,70 @@
+#ifndef MESSAGEREGISTRY_HPP_
+#define MESSAGEREGISTRY_HPP_
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+#include "common/proto/protobuf/messages.pb.h"
+#include "server/core/CoreMessage.hpp"
+#include "server/core/ServiceId.hpp"
+#include "server/network/ClientInfo.hpp"
+
+/*
+ * Maps the MSG_ID of an inbound frame to the handler that turns its payload
+ * into a CoreMessage, and to the service that message goes to. Filled in
+ * while services register at startup and read-only afterwards, so lookups
+ * take no lock.
+ */
+class MessageRegistry {
+public:
+    MessageRegistry() = default;
+
+    MessageRegistry(const MessageRegistry&) = delete;
+    MessageRegistry& operator=(const MessageRegistry&) = delete;
+
+    // Binds `std::unique_ptr<Msg> fn(ClientInfoPtr, const messages::Frame&, const Proto&)`
+    // to Id; the frame's data is parsed as Proto and the result sent to target.
+    template <messages::MSG_ID Id, auto Handler>
+    void registerMessage(ServiceId target)
+    {
+        static_assert(Id >= 0 && Id < messages::MSG_ID_ARRAYSIZE);
+        using Proto = typename HandlerTraits<decltype(Handler)>::Proto;
+
+        m_entries[Id] = {
+            [](ClientInfoPtr client, const messages::Frame& frame) -> std::unique_ptr<CoreMessage> {
+                // parsed into the read batch's arena when the frame lives in one
+                if (auto* arena = frame.GetArena()) {
+                    auto* payload = google::protobuf::Arena::CreateMessage<Proto>(arena);
+                    return payload->ParseFromString(frame.data()) ? Handler(std::move(client), frame, *payload) : nullptr;
+                }
+                Proto payload;
+                return payload.ParseFromString(frame.data()) ? Handler(std::move(client), frame, payload) : nullptr;
+            },
+            target,
+        };
+    }
+
+    // nullptr for an unregistered id or a payload that doesn't parse.
+    std::unique_ptr<CoreMessage> decode(ClientInfoPtr client, const messages::Frame& frame) const;
+
+private:
+    template <typename T>
+    struct HandlerTraits;
+
+    template <typename M, typename P>
+    struct HandlerTraits<std::unique_ptr<M> (*)(ClientInfoPtr, const messages::Frame&, const P&)> {
+        using Proto = P;
+    };
+
+    using DecodeFn = std::unique_ptr<CoreMessage> (*)(ClientInfoPtr, const messages::Frame&);
+
+    struct Entry {
+        DecodeFn decode = nullptr;
+        ServiceId target = ServiceId::Count;
+    };
+
+    std::array<Entry, messages::MSG_ID_ARRAYSIZE> m_entries {};
+};
+
+#endif /* MESSAGEREGISTRY_HPP_ */
@@ -1,14 +1,21 @@
 #include "server/core/ServerApplication.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <memory>
 
 #include "common/core/UUIDProvider.hpp"
 #include "common/logger/LoggerHandler.hpp"
 #include "common/utils/Debug.hpp"
+#include "common/utils/ThreadUtils.hpp"
 #include "common/utils/Utils.hpp"
 #include "server/core/MessageBus.hpp"
 #include "server/core/ServerConfig.hpp"
+#include "server/network/FrameCodec.hpp"
+#include "server/network/TokenValidator.hpp"
 #include "server/services/ConnectionService.hpp"
 #include "server/services/EchoService.hpp"
 
@@ -28,7 +35,8 @@ bool ServerApplication::init()
         fs::create_directory(log_path);
     }
 
-    auto log_filename = log_path / (utils::getCurrentTime("%Y-%m-%d_%H-%M-%S") + ".log");
+    auto log_fileFormat = ServerConfig::log_file_format == "binary" ? LogFileFormat::Binary : LogFileFormat::Text;
+    auto log_filename = log_path / (utils::getCurrentTime("%Y-%m-%d_%H-%M-%S") + (log_fileFormat == LogFileFormat::Binary ? ".blog" : ".log"));
 
     auto log_maxLevel = []() -> LogLevel {
         if (ServerConfig::log_level == "debug") {
@@ -46,20 +54,81 @@ bool ServerApplication::init()
         }
     }();
 
-    LoggerHandler::getInstance().init(log_maxLevel, ServerConfig::server_name, log_filename.string());
+    auto backgroundCpus = utils::parseCpuList(ServerConfig::background_cpus);
+    auto log_overflow = ServerConfig::log_overflow == "drop" ? LogOverflow::Drop : LogOverflow::Block;
+    LoggerHandler::getInstance().init(log_maxLevel, ServerConfig::server_name, log_filename.string(), { ServerConfig::log_thread_name, backgroundCpus },
+        ServerConfig::log_buffer_size, log_overflow, log_fileFormat,
+        LogRotationConfig {
+            u64(ServerConfig::log_rotate_size_mb) * 1024 * 1024,
+            std::chrono::seconds(ServerConfig::log_rotate_interval_s),
+            ServerConfig::log_compress,
+            ServerConfig::log_max_files,
+        });
+
+    ///* Initialize Token Validation */
+    // line framing has no handshake, it would let every socket in unauthenticated
+    if (!ServerConfig::auth_secret.empty() && framing::fromString(ServerConfig::network_framing) != FramingMode::LengthPrefixed) {
+        logError() << "auth_secret needs network_framing \"length\", line framing has no connect handshake.";
+        return false;
+    }
+    TokenValidator::init(ServerConfig::auth_secret, ServerConfig::auth_cache_size);
+    if (!TokenValidator::isEnabled()) {
+        logWarning() << "auth_secret is not set, clients connect without a handshake.";
+    }
+
+    ///* Initialize Thread Pool */
+    auto poolCpus = [&backgroundCpus]() -> std::vector<u32> {
+        auto cpus = utils::parseCpuList(ServerConfig::thread_pool_cpus);
+        if (!cpus.empty()) {
+            return cpus;
+        }
+
+        if (ServerConfig::thread_pool_numa_node >= 0) {
+            cpus = utils::numaNodeCpus(ServerConfig::thread_pool_numa_node);
+            if (cpus.empty()) {
+                logWarning() << "Unknown NUMA node" << ServerConfig::thread_pool_numa_node << ", thread pool is not pinned.";
+            }
+        } else if (ServerConfig::thread_pool_pin) {
+            cpus = utils::onlineCpus();
+        }
+
+        // leave the background cores to the logger
+        std::erase_if(cpus, [&backgroundCpus](u32 cpu) {
+            return std::find(backgroundCpus.begin(), backgroundCpus.end(), cpu) != backgroundCpus.end();
+        });
+        return cpus;
+    }();
+
+    m_threadPool.init(threadpool::modeFromString(ServerConfig::thread_pool_mode),
+        ServerConfig::thread_pool_size,
+        threadpool::balanceFromString(ServerConfig::thread_pool_balance),
+        ServerConfig::thread_pool_name,
+        poolCpus);
+    logDebug() << "Thread pool initialized with" << m_threadPool.getNumThreads() << "threads.";
 
     ///* Initialize UUID Provider */
     UUIDProvider::init(ServerConfig::uuid_worker_id, ServerConfig::uuid_datacenter_id, ServerConfig::uuid_twepoch);
     logDebug() << "UUID Provider initialized. Next UUID:" << UUIDProvider::nextUUID();
 
+    ///* Load Batch Compression Dictionary */
+    if (!ServerConfig::network_compress_dictionary.empty()) {
+        std::ifstream file(ServerConfig::network_compress_dictionary, std::ios::binary);
+        if (file) {
+            framing::setCompressionDictionary(std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+            logDebug() << "Batch compression dictionary loaded from" << ServerConfig::network_compress_dictionary;
+        } else {
+            logWarning() << "Can't read compression dictionary" << ServerConfig::network_compress_dictionary;
+        }
+    }
+
     ///* Initialize Connection Service */
-    auto connectionService = std::make_shared<ConnectionService>(m_threadPool, m_messageBus);
-    connectionService->init(ServerConfig::server_port);
-    m_services.emplace(connectionService->getName(), connectionService);
+    auto connectionService = std::make_shared<ConnectionService>(m_threadPool, m_messageBus, m_messageRegistry);
+    connectionService->init(ServerConfig::server_port, framing::fromString(ServerConfig::network_framing));
+    registerService(connectionService);
 
     ///* Initialize EchoService */
     auto echoService = std::make_shared<EchoService>(m_threadPool);
-    m_services.emplace(echoService->getName(), echoService);
+    registerService(echoService);
 
     ///* Register Console Commands */
     registerConsoleCommand("stop", [this](const std::string&) {
@@ -77,18 +146,18 @@ bool ServerApplication::init()
 
 void ServerApplication::run()
 {
-    bool isInitialized = init();
+    if (!init()) {
+        logError() << "Server failed to initialize.";
+        return;
+    }
 
-    for (auto& [name, service] : m_services) {
-        co_spawn(m_threadPool.getIoContext(), service->start(), detached);
-        logDebug() << name << "Service loaded.";
+    for (auto& service : m_services) {
+        if (!service)
+            continue;
+        co_spawn(service->getExecutor(), service->start(), detached);
+        logDebug() << service->getName() << "Service loaded.";
     }
 
-    m_threadPool.post([this]() {
-        while (m_isRunning) {
-            m_messageBus.processOne();
-        }
-    });
     logInfo() << "Server started.";
 
     m_isRunning = true;
@@ -96,12 +165,11 @@ void ServerApplication::run()
 
     listenConsoleInput();
 
-    if (isInitialized) {
-        logInfo() << "Stopping server...";
-    }
+    logInfo() << "Stopping server...";
 
-    for (auto& [name, service] : m_services) {
-        service->stop();
+    for (auto& service : m_services) {
+        if (service)
+            service->stop();
     }
 
     ServerConfig::saveConfigToFile("config.json");
@@ -112,6 +180,12 @@ void ServerApplication::run()
     return;
 }
 
+void ServerApplication::registerService(std::shared_ptr<Service> service)
+{
+    service->registerMessages(m_messageRegistry);
+    m_services[static_cast<std::size_t>(service->getId())] = std::move(service);
+}
+
 void ServerApplication::registerConsoleCommand(const std::string& command, CommandHandler handler)
 {
     m_consoleCommandHandlers.emplace(command, handler);
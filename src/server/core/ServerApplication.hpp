@@ -8,6 +8,8 @@
 #include "common/utils/IntTypes.hpp"
 
 #include "server/core/MessageBus.hpp"
+#include "server/core/MessageRegistry.hpp"
+#include "server/core/ServiceId.hpp"
 #include "server/core/ThreadPool.hpp"
 #include "server/services/Service.hpp"
 
@@ -32,6 +34,9 @@ public:
     void setPort(u16 port) { m_port = port; }
     void setSinglePlayer(bool singlePlayer) { m_singlePlayer = singlePlayer; }
 
+public:
+    void registerService(std::shared_ptr<Service> service);
+
 public:
     void registerConsoleCommand(const std::string& command, CommandHandler handler);
     void listenConsoleInput();
@@ -44,9 +49,10 @@ private:
 
     ThreadPool m_threadPool;
 
-    std::unordered_map<std::string, std::shared_ptr<Service>> m_services;
+    std::array<std::shared_ptr<Service>, SERVICE_COUNT> m_services;
 
     MessageBus m_messageBus;
+    MessageRegistry m_messageRegistry;
 
 private:
     std::unordered_map<std::string, CommandHandler> m_consoleCommandHandlers;
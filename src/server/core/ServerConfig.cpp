@@ -1,6 +1,8 @@
 #include <filesystem>
 #include <fstream>
 
+#include <sys/socket.h>
+
 #include <nlohmann/json.hpp>
 
 #include "common/utils/Debug.hpp"
@@ -11,7 +13,45 @@ namespace fs = std::filesystem;
 // init default config
 u16 ServerConfig::server_port = 28818;
 std::string ServerConfig::server_name = "Unnamed Server";
+std::string ServerConfig::network_framing = "line";
+u32 ServerConfig::network_max_frame_size = 64 * 1024;
+u32 ServerConfig::network_write_max_segments = 64;
+u32 ServerConfig::network_write_max_bytes = 256 * 1024;
+u32 ServerConfig::network_write_delay_us = 0;
+u32 ServerConfig::network_tick_ms = 50;
+u32 ServerConfig::network_client_shards = 64;
+u32 ServerConfig::network_acceptors = 1;
+s32 ServerConfig::network_accept_backlog = SOMAXCONN;
+bool ServerConfig::network_tcp_nodelay = true;
+bool ServerConfig::network_tcp_keepalive = false;
+s32 ServerConfig::network_socket_send_buffer = 0;
+s32 ServerConfig::network_socket_recv_buffer = 0;
+bool ServerConfig::network_batch_frames = false;
+u32 ServerConfig::network_batch_compress_threshold = 1024;
+std::string ServerConfig::network_compress_dictionary = "";
+u32 ServerConfig::network_heartbeat_timeout_ms = 60 * 1000;
+u32 ServerConfig::network_heartbeat_tick_ms = 100;
+u32 ServerConfig::network_connect_timeout_ms = 5000;
+std::string ServerConfig::auth_secret = "";
+u32 ServerConfig::auth_cache_size = 4096;
+std::string ServerConfig::thread_pool_mode = "shared";
+u16 ServerConfig::thread_pool_size = 0;
+bool ServerConfig::thread_pool_pin = false;
+std::string ServerConfig::thread_pool_balance = "round_robin";
+std::string ServerConfig::thread_pool_name = "io";
+std::string ServerConfig::thread_pool_cpus = "";
+s32 ServerConfig::thread_pool_numa_node = -1;
+std::string ServerConfig::background_cpus = "";
+u32 ServerConfig::bus_batch_size = 64;
 std::string ServerConfig::log_level = "info";
+std::string ServerConfig::log_thread_name = "logger";
+u32 ServerConfig::log_buffer_size = 8192;
+std::string ServerConfig::log_overflow = "block";
+std::string ServerConfig::log_file_format = "text";
+u32 ServerConfig::log_rotate_size_mb = 256;
+u32 ServerConfig::log_rotate_interval_s = 24 * 60 * 60;
+bool ServerConfig::log_compress = true;
+u32 ServerConfig::log_max_files = 0;
 s64 ServerConfig::uuid_worker_id = 1;
 s64 ServerConfig::uuid_datacenter_id = 1;
 s64 ServerConfig::uuid_twepoch = 687888001020L;
@@ -27,7 +67,48 @@ void ServerConfig::loadConfigFromFile(const char* filepath)
             server_port = json["server_port"];
             server_name = json["server_name"];
 
+            network_framing = json.value("network_framing", network_framing);
+            network_max_frame_size = json.value("network_max_frame_size", network_max_frame_size);
+            network_write_max_segments = json.value("network_write_max_segments", network_write_max_segments);
+            network_write_max_bytes = json.value("network_write_max_bytes", network_write_max_bytes);
+            network_write_delay_us = json.value("network_write_delay_us", network_write_delay_us);
+            network_tick_ms = json.value("network_tick_ms", network_tick_ms);
+            network_client_shards = json.value("network_client_shards", network_client_shards);
+            network_acceptors = json.value("network_acceptors", network_acceptors);
+            network_accept_backlog = json.value("network_accept_backlog", network_accept_backlog);
+            network_tcp_nodelay = json.value("network_tcp_nodelay", network_tcp_nodelay);
+            network_tcp_keepalive = json.value("network_tcp_keepalive", network_tcp_keepalive);
+            network_socket_send_buffer = json.value("network_socket_send_buffer", network_socket_send_buffer);
+            network_socket_recv_buffer = json.value("network_socket_recv_buffer", network_socket_recv_buffer);
+            network_batch_frames = json.value("network_batch_frames", network_batch_frames);
+            network_batch_compress_threshold = json.value("network_batch_compress_threshold", network_batch_compress_threshold);
+            network_compress_dictionary = json.value("network_compress_dictionary", network_compress_dictionary);
+            network_heartbeat_timeout_ms = json.value("network_heartbeat_timeout_ms", network_heartbeat_timeout_ms);
+            network_heartbeat_tick_ms = json.value("network_heartbeat_tick_ms", network_heartbeat_tick_ms);
+            network_connect_timeout_ms = json.value("network_connect_timeout_ms", network_connect_timeout_ms);
+            auth_secret = json.value("auth_secret", auth_secret);
+            auth_cache_size = json.value("auth_cache_size", auth_cache_size);
+
+            thread_pool_mode = json.value("thread_pool_mode", thread_pool_mode);
+            thread_pool_size = json.value("thread_pool_size", thread_pool_size);
+            thread_pool_pin = json.value("thread_pool_pin", thread_pool_pin);
+            thread_pool_balance = json.value("thread_pool_balance", thread_pool_balance);
+            thread_pool_name = json.value("thread_pool_name", thread_pool_name);
+            thread_pool_cpus = json.value("thread_pool_cpus", thread_pool_cpus);
+            thread_pool_numa_node = json.value("thread_pool_numa_node", thread_pool_numa_node);
+            background_cpus = json.value("background_cpus", background_cpus);
+
+            bus_batch_size = json.value("bus_batch_size", bus_batch_size);
+
             log_level = json["log_level"];
+            log_thread_name = json.value("log_thread_name", log_thread_name);
+            log_buffer_size = json.value("log_buffer_size", log_buffer_size);
+            log_overflow = json.value("log_overflow", log_overflow);
+            log_file_format = json.value("log_file_format", log_file_format);
+            log_rotate_size_mb = json.value("log_rotate_size_mb", log_rotate_size_mb);
+            log_rotate_interval_s = json.value("log_rotate_interval_s", log_rotate_interval_s);
+            log_compress = json.value("log_compress", log_compress);
+            log_max_files = json.value("log_max_files", log_max_files);
 
             uuid_worker_id = json["uuid_worker_id"];
             uuid_datacenter_id = json["uuid_datacenter_id"];
@@ -48,7 +129,48 @@ void ServerConfig::saveConfigToFile(const char* filepath)
         json["server_port"] = server_port;
         json["server_name"] = server_name;
 
+        json["network_framing"] = network_framing;
+        json["network_max_frame_size"] = network_max_frame_size;
+        json["network_write_max_segments"] = network_write_max_segments;
+        json["network_write_max_bytes"] = network_write_max_bytes;
+        json["network_write_delay_us"] = network_write_delay_us;
+        json["network_tick_ms"] = network_tick_ms;
+        json["network_client_shards"] = network_client_shards;
+        json["network_acceptors"] = network_acceptors;
+        json["network_accept_backlog"] = network_accept_backlog;
+        json["network_tcp_nodelay"] = network_tcp_nodelay;
+        json["network_tcp_keepalive"] = network_tcp_keepalive;
+        json["network_socket_send_buffer"] = network_socket_send_buffer;
+        json["network_socket_recv_buffer"] = network_socket_recv_buffer;
+        json["network_batch_frames"] = network_batch_frames;
+        json["network_batch_compress_threshold"] = network_batch_compress_threshold;
+        json["network_compress_dictionary"] = network_compress_dictionary;
+        json["network_heartbeat_timeout_ms"] = network_heartbeat_timeout_ms;
+        json["network_heartbeat_tick_ms"] = network_heartbeat_tick_ms;
+        json["network_connect_timeout_ms"] = network_connect_timeout_ms;
+        json["auth_secret"] = auth_secret;
+        json["auth_cache_size"] = auth_cache_size;
+
+        json["thread_pool_mode"] = thread_pool_mode;
+        json["thread_pool_size"] = thread_pool_size;
+        json["thread_pool_pin"] = thread_pool_pin;
+        json["thread_pool_balance"] = thread_pool_balance;
+        json["thread_pool_name"] = thread_pool_name;
+        json["thread_pool_cpus"] = thread_pool_cpus;
+        json["thread_pool_numa_node"] = thread_pool_numa_node;
+        json["background_cpus"] = background_cpus;
+
+        json["bus_batch_size"] = bus_batch_size;
+
         json["log_level"] = log_level;
+        json["log_thread_name"] = log_thread_name;
+        json["log_buffer_size"] = log_buffer_size;
+        json["log_overflow"] = log_overflow;
+        json["log_file_format"] = log_file_format;
+        json["log_rotate_size_mb"] = log_rotate_size_mb;
+        json["log_rotate_interval_s"] = log_rotate_interval_s;
+        json["log_compress"] = log_compress;
+        json["log_max_files"] = log_max_files;
 
         json["uuid_worker_id"] = uuid_worker_id;
         json["uuid_datacenter_id"] = uuid_datacenter_id;
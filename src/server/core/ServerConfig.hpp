@@ -11,8 +11,52 @@ namespace ServerConfig {
 extern u16 server_port;
 extern std::string server_name;
 
+/* Network Config */
+extern std::string network_framing;
+extern u32 network_max_frame_size;
+extern u32 network_write_max_segments;
+extern u32 network_write_max_bytes;
+extern u32 network_write_delay_us;
+extern u32 network_tick_ms;
+extern u32 network_client_shards;
+extern u32 network_acceptors;
+extern s32 network_accept_backlog;
+extern bool network_tcp_nodelay;
+extern bool network_tcp_keepalive;
+extern s32 network_socket_send_buffer;
+extern s32 network_socket_recv_buffer;
+extern bool network_batch_frames;
+extern u32 network_batch_compress_threshold;
+extern std::string network_compress_dictionary;
+extern u32 network_heartbeat_timeout_ms;
+extern u32 network_heartbeat_tick_ms;
+extern u32 network_connect_timeout_ms;
+extern std::string auth_secret;
+extern u32 auth_cache_size;
+
+/* Thread Pool Config */
+extern std::string thread_pool_mode;
+extern u16 thread_pool_size;
+extern bool thread_pool_pin;
+extern std::string thread_pool_balance;
+extern std::string thread_pool_name;
+extern std::string thread_pool_cpus;
+extern s32 thread_pool_numa_node;
+extern std::string background_cpus;
+
+/* Message Bus Config */
+extern u32 bus_batch_size;
+
 /* Logger Config */
 extern std::string log_level;
+extern std::string log_thread_name;
+extern u32 log_buffer_size;
+extern std::string log_overflow;
+extern std::string log_file_format;
+extern u32 log_rotate_size_mb;
+extern u32 log_rotate_interval_s;
+extern bool log_compress;
+extern u32 log_max_files;
 
 /* UUID Provider Config */
 extern s64 uuid_worker_id;
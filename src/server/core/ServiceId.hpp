@@ -0,0 +1,18 @@
+#ifndef SERVICEID_HPP_
+#define SERVICEID_HPP_
+
+#include <cstddef>
+
+#include "common/utils/IntTypes.hpp"
+
+// Dense ids, services and bus routing are plain array lookups.
+enum class ServiceId : u16 {
+    Connection,
+    Echo,
+
+    Count
+};
+
+constexpr std::size_t SERVICE_COUNT = static_cast<std::size_t>(ServiceId::Count);
+
+#endif /* SERVICEID_HPP_ */
@@ -0,0 +1,219 @@
+#include "server/core/ThreadPool.hpp"
+
+#include "common/utils/Debug.hpp"
+
+namespace {
+
+// tasks run per drain before yielding back to the worker's io_context
+constexpr std::size_t TASK_BATCH = 64;
+// queue depth at which a neighbour gets woken to help
+constexpr std::size_t STEAL_THRESHOLD = 2;
+
+thread_local const ThreadPool* t_pool = nullptr;
+thread_local std::size_t t_workerIndex = 0;
+
+} // namespace
+
+ThreadPool::~ThreadPool()
+{
+    stop();
+}
+
+void ThreadPool::init(ThreadPoolMode mode, u16 numThreads, ThreadPoolBalance balance, const std::string& threadName, const std::vector<u32>& cpus)
+{
+    m_mode = mode;
+    m_balance = balance;
+    m_numThreads = numThreads > 0 ? numThreads : std::max(1u, std::thread::hardware_concurrency());
+
+    m_placements.clear();
+    for (u16 i = 0; i < m_numThreads; ++i) {
+        utils::ThreadPlacement placement { threadName + "-" + std::to_string(i), {} };
+        if (!cpus.empty()) {
+            placement.cpus.push_back(cpus[i % cpus.size()]);
+        }
+        m_placements.push_back(std::move(placement));
+    }
+
+    m_workers.clear();
+    if (m_mode == ThreadPoolMode::Shared) {
+        m_workers.push_back(std::make_unique<Worker>(m_numThreads));
+    } else {
+        // a single thread per context lets asio skip its internal locking
+        for (u16 i = 0; i < m_numThreads; ++i) {
+            m_workers.push_back(std::make_unique<Worker>(1));
+        }
+    }
+}
+
+asio::io_context& ThreadPool::getIoContext()
+{
+    if (auto* worker = currentWorker()) {
+        return worker->ioContext;
+    }
+    return m_workers[m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size()]->ioContext;
+}
+
+IoLease ThreadPool::nextIoContext()
+{
+    std::size_t index = 0;
+    if (m_balance == ThreadPoolBalance::LeastLoaded) {
+        u32 minLoad = UINT32_MAX;
+        for (std::size_t i = 0; i < m_workers.size(); ++i) {
+            u32 load = m_workers[i]->load.load(std::memory_order_relaxed);
+            if (load < minLoad) {
+                minLoad = load;
+                index = i;
+            }
+        }
+    } else {
+        index = m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+    }
+
+    return leaseIoContext(index);
+}
+
+IoLease ThreadPool::leaseIoContext(std::size_t index)
+{
+    auto& worker = *m_workers[index];
+    return IoLease(worker.ioContext, index, worker.load);
+}
+
+void ThreadPool::run()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isRunning) {
+        return;
+    }
+
+    m_threads.reserve(m_numThreads);
+    for (u16 i = 0; i < m_numThreads; ++i) {
+        std::size_t index = m_mode == ThreadPoolMode::PerCore ? i : 0;
+        m_threads.emplace_back([this, i, index]() {
+            // placed before running anything, thread_local caches and message
+            // slabs are then allocated on this thread's NUMA node
+            if (!m_placements[i].apply()) {
+                logWarning() << "Failed to pin" << m_placements[i].name << "to cpu" << m_placements[i].cpus.front();
+            }
+
+            t_pool = this;
+            t_workerIndex = index;
+            m_workers[index]->ioContext.run();
+            t_pool = nullptr;
+        });
+    }
+
+    m_isRunning = true;
+}
+
+void ThreadPool::stop()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_isRunning) {
+        return;
+    }
+
+    for (auto& worker : m_workers) {
+        worker->work.reset();
+        worker->ioContext.stop();
+    }
+
+    for (auto& thread : m_threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    m_isRunning = false;
+    m_threads.clear();
+    for (auto& worker : m_workers) {
+        worker->ioContext.restart();
+        worker->work.emplace(asio::make_work_guard(worker->ioContext));
+    }
+}
+
+void ThreadPool::submit(Task task)
+{
+    std::size_t index = 0;
+    Worker* worker = currentWorker(&index);
+    if (!worker) {
+        index = m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+        worker = m_workers[index].get();
+    }
+
+    std::size_t depth;
+    {
+        std::lock_guard<std::mutex> lock(worker->taskMutex);
+        worker->tasks.push_back(std::move(task));
+        depth = worker->tasks.size();
+    }
+    scheduleDrain(index);
+
+    if (depth >= STEAL_THRESHOLD && m_workers.size() > 1) {
+        scheduleDrain((index + 1) % m_workers.size());
+    }
+}
+
+void ThreadPool::scheduleDrain(std::size_t index)
+{
+    auto& worker = *m_workers[index];
+    if (!worker.drainScheduled.exchange(true, std::memory_order_acq_rel)) {
+        asio::post(worker.ioContext, [this, index]() { drain(index); });
+    }
+}
+
+void ThreadPool::drain(std::size_t index)
+{
+    auto& worker = *m_workers[index];
+    // cleared first, a task pushed from here on schedules another drain
+    worker.drainScheduled.store(false, std::memory_order_release);
+
+    std::size_t count = 0;
+    Task task;
+    while (count < TASK_BATCH && (popLocal(worker, task) || steal(index, task))) {
+        task();
+        ++count;
+    }
+
+    if (count == TASK_BATCH) {
+        scheduleDrain(index);
+    }
+}
+
+bool ThreadPool::popLocal(Worker& worker, Task& task)
+{
+    std::lock_guard<std::mutex> lock(worker.taskMutex);
+    if (worker.tasks.empty()) {
+        return false;
+    }
+    // FIFO for the owner, tasks that requeue themselves go behind the rest
+    task = std::move(worker.tasks.front());
+    worker.tasks.pop_front();
+    return true;
+}
+
+bool ThreadPool::steal(std::size_t thief, Task& task)
+{
+    for (std::size_t i = 1; i < m_workers.size(); ++i) {
+        auto& victim = *m_workers[(thief + i) % m_workers.size()];
+        std::unique_lock<std::mutex> lock(victim.taskMutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty()) {
+            continue;
+        }
+        // thieves work the other end and rarely meet the owner
+        task = std::move(victim.tasks.back());
+        victim.tasks.pop_back();
+        return true;
+    }
+    return false;
+}
+
+ThreadPool::Worker* ThreadPool::currentWorker(std::size_t* index) const
+{
+    if (t_pool != this) {
+        return nullptr;
+    }
+    if (index) {
+        *index = t_workerIndex;
+    }
+    return m_workers[t_workerIndex].get();
+}
@@ -1,73 +1,166 @@
 #ifndef THREADPOOL_HPP_
 #define THREADPOOL_HPP_
 
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
+#include <asio/executor_work_guard.hpp>
 #include <asio/io_context.hpp>
+#include <asio/post.hpp>
 
 #include "common/utils/IntTypes.hpp"
+#include "common/utils/ThreadUtils.hpp"
 
 class ServerApplication;
 
-class ThreadPool final {
-    friend class ServerApplication;
+enum class ThreadPoolMode : u8 {
+    // every thread runs the same io_context
+    Shared,
+    // one io_context per thread, tasks balanced by work-stealing
+    PerCore,
+};
+
+enum class ThreadPoolBalance : u8 {
+    RoundRobin,
+    LeastLoaded,
+};
 
+namespace threadpool {
+
+inline ThreadPoolMode modeFromString(const std::string& mode)
+{
+    return mode == "per_core" ? ThreadPoolMode::PerCore : ThreadPoolMode::Shared;
+}
+
+inline ThreadPoolBalance balanceFromString(const std::string& balance)
+{
+    return balance == "least_loaded" ? ThreadPoolBalance::LeastLoaded : ThreadPoolBalance::RoundRobin;
+}
+
+} // namespace threadpool
+
+/*
+ * Counts one connection against the io_context it was placed on, so the
+ * least-loaded policy sees it until the owner goes away.
+ */
+class IoLease {
 public:
-    ThreadPool(u16 numThreads = std::thread::hardware_concurrency())
-        : m_numThreads(numThreads)
+    IoLease() = default;
+    IoLease(asio::io_context& ioContext, std::size_t index, std::atomic<u32>& load)
+        : m_ioContext(&ioContext)
+        , m_index(index)
+        , m_load(&load)
     {
-        m_threads.reserve(m_numThreads);
+        m_load->fetch_add(1, std::memory_order_relaxed);
     }
-    ~ThreadPool()
+    IoLease(IoLease&& other) noexcept
+        : m_ioContext(std::exchange(other.m_ioContext, nullptr))
+        , m_index(other.m_index)
+        , m_load(std::exchange(other.m_load, nullptr))
     {
-        m_ioContext.stop();
-
-        for (auto& thread : m_threads) {
-            thread.join();
-        }
     }
-
-    void post(std::function<void()>&& task)
+    ~IoLease()
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_ioContext.post(std::move(task));
+        if (m_load) {
+            m_load->fetch_sub(1, std::memory_order_relaxed);
+        }
     }
 
-    asio::io_context& getIoContext() { return m_ioContext; }
+    IoLease(const IoLease&) = delete;
+    IoLease& operator=(const IoLease&) = delete;
+    IoLease& operator=(IoLease&&) = delete;
+
+    asio::io_context& ioContext() const { return *m_ioContext; }
+    // position of ioContext() in the pool, see ThreadPool::getIoContext(index)
+    std::size_t index() const { return m_index; }
 
 private:
-    void run()
-    {
-        for (u16 i = 0; i < m_numThreads; ++i) {
-            m_threads.emplace_back([this]() {
-                m_ioContext.run();
-            });
-        }
+    asio::io_context* m_ioContext = nullptr;
+    std::size_t m_index = 0;
+    std::atomic<u32>* m_load = nullptr;
+};
 
-        m_isRunning = true;
-    }
+class ThreadPool final {
+    friend class ServerApplication;
+
+public:
+    using Task = std::function<void()>;
+
+    ThreadPool() = default;
+    ~ThreadPool();
+
+    // Must be called once before anything asks for an io_context. Threads are
+    // named "<threadName>-<n>"; with a non-empty cpu list thread n is pinned
+    // to cpus[n % cpus.size()].
+    void init(ThreadPoolMode mode, u16 numThreads, ThreadPoolBalance balance, const std::string& threadName, const std::vector<u32>& cpus);
 
-    void stop()
+    // Runs a CPU-bound task on the pool. In PerCore mode it lands on the
+    // calling worker's queue and idle neighbours steal from it.
+    template <typename F>
+    void post(F&& task)
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (!m_isRunning) {
-            return;
+        if (m_mode == ThreadPoolMode::Shared) {
+            asio::post(m_workers.front()->ioContext, std::forward<F>(task));
+        } else {
+            submit(Task(std::forward<F>(task)));
         }
+    }
+
+    // The calling worker's io_context, or the next one round-robin when
+    // called from outside the pool.
+    asio::io_context& getIoContext();
+
+    // Picks an io_context for a new connection according to the balance policy.
+    IoLease nextIoContext();
+    IoLease leaseIoContext(std::size_t index);
+
+    // One in Shared mode, one per thread in PerCore mode.
+    std::size_t getIoContextCount() const { return m_workers.size(); }
+    asio::io_context& getIoContext(std::size_t index) { return m_workers[index]->ioContext; }
 
-        m_ioContext.stop();
-        m_work.~work();
+    ThreadPoolMode getMode() const { return m_mode; }
+    u16 getNumThreads() const { return m_numThreads; }
 
-        for (auto& thread : m_threads) {
-            if (thread.joinable()) {
-                thread.join();
-            }
+private:
+    void run();
+    void stop();
+
+private:
+    struct alignas(64) Worker {
+        explicit Worker(int concurrencyHint)
+            : ioContext(concurrencyHint)
+            , work(asio::make_work_guard(ioContext))
+        {
         }
 
-        m_isRunning = false;
-        m_threads.clear();
-        m_ioContext.reset();
-    }
+        // declared ahead of ioContext so they outlive it: ~io_context
+        // destroys pending handlers, whose sessions release their IoLease
+        std::mutex taskMutex;
+        std::deque<Task> tasks;
+        std::atomic<bool> drainScheduled = false;
+
+        // connections placed here, see IoLease
+        std::atomic<u32> load = 0;
+
+        asio::io_context ioContext;
+        std::optional<asio::executor_work_guard<asio::io_context::executor_type>> work;
+    };
+
+    void submit(Task task);
+    void scheduleDrain(std::size_t index);
+    void drain(std::size_t index);
+    bool popLocal(Worker& worker, Task& task);
+    bool steal(std::size_t thief, Task& task);
+
+    Worker* currentWorker(std::size_t* index = nullptr) const;
 
 private:
     ThreadPool(const ThreadPool&) = delete;
@@ -77,14 +170,18 @@ private:
     ThreadPool& operator=(ThreadPool&&) = delete;
 
 private:
-    u16 m_numThreads = std::thread::hardware_concurrency();
+    ThreadPoolMode m_mode = ThreadPoolMode::Shared;
+    ThreadPoolBalance m_balance = ThreadPoolBalance::RoundRobin;
+    u16 m_numThreads = 0;
     bool m_isRunning = false;
-    asio::io_context m_ioContext;
-    asio::io_context::work m_work { m_ioContext };
+    std::vector<utils::ThreadPlacement> m_placements;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
     std::vector<std::thread> m_threads;
+    std::atomic<u32> m_nextWorker = 0;
 
 private:
     std::mutex m_mutex;
 };
 
-#endif /* THREADPOOL_HPP_ */
\ No newline at end of file
+#endif /* THREADPOOL_HPP_ */
@@ -1,7 +1,11 @@
 #include "server/network/ClientInfo.hpp"
 
+#include "server/network/FrameCodec.hpp"
+
 ClientInfo::~ClientInfo() { }
 
 s64 ClientInfo::getId() const { return m_id; }
 
 std::string ClientInfo::getName() const { return m_name; }
+
+void ClientInfo::sendFrame(const messages::Frame& frame) { send(framing::encodeFrame(frame)); }
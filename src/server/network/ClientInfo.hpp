@@ -2,15 +2,26 @@
 #define CLIENTINFO_HPP_
 
 #include <asio/ip/tcp.hpp>
+#include <memory>
 #include <string>
 
+#include "common/proto/protobuf/messages.pb.h"
 #include "common/utils/IntTypes.hpp"
+#include "server/network/MessageBuffer.hpp"
 
 class ClientInfo {
 public:
     virtual ~ClientInfo();
 
-    virtual void send(const std::string& msg) = 0;
+    virtual void send(MessageBuffer msg) = 0;
+    void send(const std::string& msg) { send(MessageBuffer(msg)); }
+    void sendFrame(const messages::Frame& frame);
+
+    // Push out anything held back by write batching, called at the end of a tick.
+    virtual void flush() { }
+
+    // Drops the connection, safe to call from any thread.
+    virtual void close() { }
 
     s64 getId() const;
     void setId(const s64 _id) { this->m_id = _id; }
@@ -18,8 +29,12 @@ public:
     void setName(const std::string _name) { this->m_name = _name; }
 
 private:
-    s64 m_id;
+    // the id a connect token proved, otherwise 0 until ClientManager
+    // registers the client
+    s64 m_id = 0;
     std::string m_name;
 };
 
+using ClientInfoPtr = std::shared_ptr<ClientInfo>;
+
 #endif /* CLIENTINFO_HPP_ */
@@ -2,51 +2,87 @@
 
 #include "common/core/UUIDProvider.hpp"
 #include "common/utils/Debug.hpp"
+#include "server/core/ServerConfig.hpp"
 #include "server/services/EchoService.hpp"
 #include <memory>
 
+ClientManager::ClientManager(MessageBus& messageBus, const MessageRegistry& messageRegistry)
+    : m_clients(ServerConfig::network_client_shards)
+    , m_messageBus(messageBus)
+    , m_messageRegistry(messageRegistry)
+{
+}
+
 void ClientManager::addClient(ClientInfoPtr client)
 {
-    client->setId(UUIDProvider::nextUUID());
-    m_clients.insert(std::pair<s64, ClientInfoPtr>(client->getId(), client));
-    logInfo() << LOG_PREFIX << "Client " << client->getId() << " connected.";
+    // authenticated clients arrive with the id their token proved
+    if (client->getId() == 0)
+        client->setId(UUIDProvider::nextUUID());
+
+    // the latest login wins, an older session of the same client is closed
+    if (auto previous = m_clients.replace(client)) {
+        logEvent(LogLevel::Info, LOG_PREFIX " Client {} connected again, closing its previous session.", client->getId());
+        previous->close();
+    }
+    logEvent(LogLevel::Info, LOG_PREFIX " Client {} connected.", client->getId());
 }
 
 void ClientManager::removeClient(ClientInfoPtr client)
 {
-    m_clients.erase(client->getId());
-    logInfo() << LOG_PREFIX << "Client " << client->getId() << " disconnected.";
+    // both halves of a session report the disconnect, only log it once
+    if (m_clients.erase(client))
+        logEvent(LogLevel::Info, LOG_PREFIX " Client {} disconnected.", client->getId());
 }
 
 void ClientManager::broadcast(const std::string& msg)
 {
-    for (auto& client : m_clients) {
-        client.second->send(msg);
-    }
+    broadcast(MessageBuffer(msg));
+}
+
+void ClientManager::broadcast(const MessageBuffer& msg)
+{
+    m_clients.forEach([&msg](const ClientInfoPtr& client) {
+        client->send(msg);
+    });
+}
+
+void ClientManager::flush()
+{
+    m_clients.forEach([](const ClientInfoPtr& client) {
+        client->flush();
+    });
 }
 
 std::set<ClientInfoPtr> ClientManager::getClients() const
 {
     std::set<ClientInfoPtr> clients;
-    for (auto& client : m_clients) {
-        clients.insert(client.second);
-    }
+    m_clients.forEach([&clients](const ClientInfoPtr& client) {
+        clients.insert(client);
+    });
     return clients;
 }
 
 ClientInfoPtr ClientManager::getClientById(s64 id) const
 {
-    auto client = m_clients.find(id);
-    if (client != m_clients.end()) {
-        return client->second;
-    }
-    return nullptr;
+    return m_clients.find(id);
 }
 
 void ClientManager::onMessageReceived(ClientInfoPtr client, const std::string& msg)
 {
-    logInfo() << LOG_PREFIX << "Message received from client" << client->getId() << ">>" << msg;
+    logEvent(LogLevel::Debug, LOG_PREFIX " Message received from client {} >> {}", client->getId(), msg);
 
-    auto echoMsg = std::make_unique<EchoMessage>(client, msg, "ConnectionService");
+    auto echoMsg = std::make_unique<EchoMessage>(std::move(client), msg, ServiceId::Connection);
     m_messageBus.send(std::move(echoMsg));
+}
+
+void ClientManager::onFrameReceived(ClientInfoPtr client, const messages::Frame& frame)
+{
+    logEvent(LogLevel::Debug, LOG_PREFIX " Frame {} received from client {}", frame.msgid(), client->getId());
+
+    auto message = m_messageRegistry.decode(client, frame);
+    if (!message) {
+        logEvent(LogLevel::Debug, LOG_PREFIX " Dropped frame {} from client {}, unknown id or bad payload", frame.msgid(), client->getId());
+        return;
+    }
+    m_messageBus.send(std::move(message));
 }
\ No newline at end of file
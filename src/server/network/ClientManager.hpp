@@ -3,36 +3,46 @@
 
 #include <memory>
 #include <set>
-#include <unordered_map>
 
+#include "common/proto/protobuf/messages.pb.h"
 #include "common/utils/IntTypes.hpp"
 #include "server/core/MessageBus.hpp"
+#include "server/core/MessageRegistry.hpp"
 #include "server/network/ClientInfo.hpp"
+#include "server/network/ClientRegistry.hpp"
 
 #define LOG_PREFIX "[ClientManager]"
 
-using ClientInfoPtr = std::shared_ptr<ClientInfo>;
-
 class ClientManager {
 public:
-    ClientManager(MessageBus& messageBus)
-        : m_messageBus(messageBus) {};
+    ClientManager(MessageBus& messageBus, const MessageRegistry& messageRegistry);
     void addClient(ClientInfoPtr client);
     void removeClient(ClientInfoPtr client);
 
     void broadcast(const std::string& msg);
+    void broadcast(const MessageBuffer& msg);
+    void flush();
 
     std::set<ClientInfoPtr> getClients() const;
     ClientInfoPtr getClientById(s64 id) const;
+    std::size_t getClientCount() const { return m_clients.size(); }
+
+    template <typename Fn>
+    void forEachClient(Fn&& fn) const
+    {
+        m_clients.forEach(std::forward<Fn>(fn));
+    }
 
 public:
     void onMessageReceived(ClientInfoPtr client, const std::string& msg);
+    void onFrameReceived(ClientInfoPtr client, const messages::Frame& frame);
 
 private:
-    std::unordered_map<s64, ClientInfoPtr> m_clients;
+    ClientRegistry m_clients;
 
 private:
     MessageBus& m_messageBus;
+    const MessageRegistry& m_messageRegistry;
 };
 
 #endif /* CLIENTMANAGER_HPP_ */
\ No newline at end of file
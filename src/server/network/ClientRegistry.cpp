@@ -0,0 +1,64 @@
+#include "server/network/ClientRegistry.hpp"
+
+#include <utility>
+
+ClientRegistry::ClientRegistry(std::size_t shardCount)
+    : m_shardCount(shardCount > 0 ? shardCount : 1)
+    , m_shards(std::make_unique<Shard[]>(m_shardCount))
+{
+}
+
+bool ClientRegistry::insert(const ClientInfoPtr& client)
+{
+    auto& shard = shardFor(client->getId());
+    std::unique_lock lock(shard.mutex);
+    if (!shard.clients.emplace(client->getId(), client).second)
+        return false;
+
+    m_size.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+ClientInfoPtr ClientRegistry::replace(const ClientInfoPtr& client)
+{
+    auto& shard = shardFor(client->getId());
+    std::unique_lock lock(shard.mutex);
+    auto [it, inserted] = shard.clients.try_emplace(client->getId(), client);
+    if (inserted) {
+        m_size.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    return std::exchange(it->second, client);
+}
+
+bool ClientRegistry::erase(const ClientInfoPtr& client)
+{
+    auto& shard = shardFor(client->getId());
+    std::unique_lock lock(shard.mutex);
+    auto it = shard.clients.find(client->getId());
+    if (it == shard.clients.end() || it->second != client)
+        return false;
+
+    shard.clients.erase(it);
+    m_size.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+ClientInfoPtr ClientRegistry::find(s64 id) const
+{
+    auto& shard = shardFor(id);
+    std::shared_lock lock(shard.mutex);
+    auto it = shard.clients.find(id);
+    return it != shard.clients.end() ? it->second : nullptr;
+}
+
+ClientRegistry::Shard& ClientRegistry::shardFor(s64 id) const
+{
+    // snowflake ids share their high bits and mostly differ in the low
+    // sequence bits, so mix everything down before picking a shard
+    u64 h = static_cast<u64>(id);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return m_shards[h % m_shardCount];
+}
@@ -0,0 +1,59 @@
+#ifndef CLIENTREGISTRY_HPP_
+#define CLIENTREGISTRY_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "common/utils/IntTypes.hpp"
+#include "server/network/ClientInfo.hpp"
+
+/*
+ * Concurrent id -> client map split into independently locked shards.
+ * Lookups and iteration only take a shard's shared lock, so readers never
+ * contend with each other, and writers only block the one shard they touch.
+ */
+class ClientRegistry {
+public:
+    explicit ClientRegistry(std::size_t shardCount);
+
+    bool insert(const ClientInfoPtr& client);
+    // Inserts client, returns the one it displaced under the same id if any.
+    ClientInfoPtr replace(const ClientInfoPtr& client);
+    // Only erases the entry if it still is this client, not a newer one
+    // that replaced it.
+    bool erase(const ClientInfoPtr& client);
+    ClientInfoPtr find(s64 id) const;
+
+    std::size_t size() const { return m_size.load(std::memory_order_relaxed); }
+
+    // Visits every client in place, one shard at a time, without copying the
+    // registry. fn must not insert into or erase from the registry.
+    template <typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        for (std::size_t i = 0; i < m_shardCount; ++i) {
+            std::shared_lock lock(m_shards[i].mutex);
+            for (const auto& [id, client] : m_shards[i].clients) {
+                fn(client);
+            }
+        }
+    }
+
+private:
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<s64, ClientInfoPtr> clients;
+    };
+
+    Shard& shardFor(s64 id) const;
+
+private:
+    std::size_t m_shardCount;
+    std::unique_ptr<Shard[]> m_shards;
+    std::atomic<std::size_t> m_size = 0;
+};
+
+#endif /* CLIENTREGISTRY_HPP_ */
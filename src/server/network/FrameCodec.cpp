@@ -0,0 +1,178 @@
+#include "server/network/FrameCodec.hpp"
+
+#include <cstring>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+#include <zlib.h>
+
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::internal::WireFormatLite;
+
+namespace {
+
+std::string s_dictionary;
+
+/*
+ * zlib stream reused by every batch compressed on this thread; deflateReset
+ * keeps its window and hash tables allocated.
+ */
+class BatchCompressor {
+public:
+    BatchCompressor()
+    {
+        m_ok = deflateInit(&m_stream, Z_BEST_SPEED) == Z_OK;
+    }
+
+    ~BatchCompressor()
+    {
+        if (m_ok) {
+            deflateEnd(&m_stream);
+        }
+    }
+
+    // The compressed bytes, empty on failure. Valid until the next call.
+    std::string_view compress(std::string_view input)
+    {
+        if (!m_ok || deflateReset(&m_stream) != Z_OK) {
+            return {};
+        }
+        if (!s_dictionary.empty()) {
+            deflateSetDictionary(&m_stream, reinterpret_cast<const Bytef*>(s_dictionary.data()), static_cast<uInt>(s_dictionary.size()));
+        }
+
+        m_output.resize(deflateBound(&m_stream, static_cast<uLong>(input.size())));
+        m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        m_stream.avail_in = static_cast<uInt>(input.size());
+        m_stream.next_out = reinterpret_cast<Bytef*>(m_output.data());
+        m_stream.avail_out = static_cast<uInt>(m_output.size());
+        if (deflate(&m_stream, Z_FINISH) != Z_STREAM_END) {
+            return {};
+        }
+        return { m_output.data(), m_output.size() - m_stream.avail_out };
+    }
+
+private:
+    z_stream m_stream {};
+    bool m_ok = false;
+    std::string m_output;
+};
+
+constexpr u32 BATCH_FRAMES_TAG = WireFormatLite::MakeTag(messages::FrameBatch::kFramesFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+constexpr u32 MSG_ID_TAG = WireFormatLite::MakeTag(messages::Frame::kMsgIdFieldNumber, WireFormatLite::WIRETYPE_VARINT);
+constexpr u32 FRAME_ID_TAG = WireFormatLite::MakeTag(messages::Frame::kFrameIdFieldNumber, WireFormatLite::WIRETYPE_VARINT);
+constexpr u32 DATA_TAG = WireFormatLite::MakeTag(messages::Frame::kDataFieldNumber, WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+constexpr u32 COMPRESSED_TAG = WireFormatLite::MakeTag(messages::Frame::kCompressedFieldNumber, WireFormatLite::WIRETYPE_VARINT);
+
+// Every tag above fits in one byte.
+u8* writeBatch(u8* out, const std::deque<MessageBuffer>& frames, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& frame = frames[i];
+        *out++ = static_cast<u8>(BATCH_FRAMES_TAG);
+        out = CodedOutputStream::WriteVarint32ToArray(static_cast<u32>(frame.size()), out);
+        std::memcpy(out, frame.data(), frame.size());
+        out += frame.size();
+    }
+    return out;
+}
+
+google::protobuf::ArenaOptions arenaOptions(char* initialBlock, std::size_t size)
+{
+    google::protobuf::ArenaOptions options;
+    options.initial_block = initialBlock;
+    options.initial_block_size = size;
+    return options;
+}
+
+} // namespace
+
+FrameDecoder::FrameDecoder()
+    : m_initialBlock(std::make_unique_for_overwrite<char[]>(INITIAL_BLOCK_SIZE))
+    , m_arena(arenaOptions(m_initialBlock.get(), INITIAL_BLOCK_SIZE))
+{
+}
+
+FrameDecoder& FrameDecoder::local()
+{
+    thread_local FrameDecoder decoder;
+    return decoder;
+}
+
+messages::Frame* FrameDecoder::decode(const u8* data, std::size_t size)
+{
+    auto* frame = google::protobuf::Arena::CreateMessage<messages::Frame>(&m_arena);
+    if (!frame->ParseFromArray(data, static_cast<int>(size))) {
+        return nullptr;
+    }
+    return frame;
+}
+
+void FrameDecoder::reset()
+{
+    // keeps the initial block, anything a large batch spilled over is freed
+    m_arena.Reset();
+}
+
+namespace framing {
+
+MessageBuffer encodeFrame(const messages::Frame& frame)
+{
+    std::size_t size = frame.ByteSizeLong();
+    return MessageBuffer(size, [&frame](char* out) {
+        frame.SerializeWithCachedSizesToArray(reinterpret_cast<u8*>(out));
+    });
+}
+
+void setCompressionDictionary(std::string dictionary)
+{
+    s_dictionary = std::move(dictionary);
+}
+
+MessageBuffer encodeBatch(const std::deque<MessageBuffer>& frames, std::size_t count, s32 frameId, std::size_t compressThreshold)
+{
+    std::size_t batchSize = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        batchSize += 1 + CodedOutputStream::VarintSize32(static_cast<u32>(frames[i].size())) + frames[i].size();
+    }
+
+    // the FrameBatch goes through a scratch buffer only when it gets compressed
+    std::string_view compressed;
+    if (compressThreshold > 0 && batchSize >= compressThreshold) {
+        thread_local std::string scratch;
+        thread_local BatchCompressor compressor;
+        scratch.resize(batchSize);
+        writeBatch(reinterpret_cast<u8*>(scratch.data()), frames, count);
+        compressed = compressor.compress(scratch);
+        if (compressed.size() >= batchSize) {
+            compressed = {};
+        }
+    }
+
+    std::size_t dataSize = compressed.empty() ? batchSize : compressed.size();
+    std::size_t size = 1 + CodedOutputStream::VarintSize32(messages::MSG_SERVER_BATCH)
+        + 1 + CodedOutputStream::VarintSize32SignExtended(frameId)
+        + 1 + CodedOutputStream::VarintSize32(static_cast<u32>(dataSize)) + dataSize
+        + (compressed.empty() ? 0 : 2);
+
+    return MessageBuffer(size, [&](char* buffer) {
+        u8* out = reinterpret_cast<u8*>(buffer);
+        *out++ = static_cast<u8>(MSG_ID_TAG);
+        out = CodedOutputStream::WriteVarint32ToArray(messages::MSG_SERVER_BATCH, out);
+        *out++ = static_cast<u8>(FRAME_ID_TAG);
+        out = CodedOutputStream::WriteVarint32SignExtendedToArray(frameId, out);
+        *out++ = static_cast<u8>(DATA_TAG);
+        out = CodedOutputStream::WriteVarint32ToArray(static_cast<u32>(dataSize), out);
+        if (compressed.empty()) {
+            writeBatch(out, frames, count);
+        } else {
+            std::memcpy(out, compressed.data(), compressed.size());
+            out += compressed.size();
+            *out++ = static_cast<u8>(COMPRESSED_TAG);
+            *out++ = 1;
+        }
+    });
+}
+
+} // namespace framing
@@ -0,0 +1,58 @@
+#ifndef FRAMECODEC_HPP_
+#define FRAMECODEC_HPP_
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <string>
+
+#include <google/protobuf/arena.h>
+
+#include "common/proto/protobuf/messages.pb.h"
+#include "common/utils/IntTypes.hpp"
+#include "server/network/MessageBuffer.hpp"
+
+/*
+ * Parses the frames of one read batch into an arena that is reset once the
+ * batch has been dispatched. Steady state batches fit the initial block, so
+ * decoding doesn't go back to the heap for the frames themselves.
+ */
+class FrameDecoder {
+public:
+    FrameDecoder();
+
+    FrameDecoder(const FrameDecoder&) = delete;
+    FrameDecoder& operator=(const FrameDecoder&) = delete;
+
+    // The calling thread's decoder, shared by every session on it. Batches
+    // are decoded and dispatched without suspending, so they never overlap.
+    static FrameDecoder& local();
+
+    // nullptr when the data isn't a valid frame. The frame lives until reset().
+    messages::Frame* decode(const u8* data, std::size_t size);
+
+    void reset();
+
+private:
+    static constexpr std::size_t INITIAL_BLOCK_SIZE = 64 * 1024;
+
+    std::unique_ptr<char[]> m_initialBlock;
+    google::protobuf::Arena m_arena;
+};
+
+namespace framing {
+
+// Serializes frame straight into the buffer handed to the session writer.
+MessageBuffer encodeFrame(const messages::Frame& frame);
+
+// Preset dictionary for batch compression, set once before any session writes.
+void setCompressionDictionary(std::string dictionary);
+
+// Packs the first count frames into one MSG_SERVER_BATCH frame stamped with
+// frameId. A FrameBatch of at least compressThreshold bytes is deflated,
+// unless that doesn't make it smaller; 0 never compresses.
+MessageBuffer encodeBatch(const std::deque<MessageBuffer>& frames, std::size_t count, s32 frameId, std::size_t compressThreshold);
+
+} // namespace framing
+
+#endif /* FRAMECODEC_HPP_ */
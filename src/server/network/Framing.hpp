@@ -0,0 +1,40 @@
+#ifndef FRAMING_HPP_
+#define FRAMING_HPP_
+
+#include <cstddef>
+#include <string>
+
+#include "common/utils/IntTypes.hpp"
+
+enum class FramingMode : u8 {
+    // '\n' delimited text, kept for debugging with telnet/nc
+    Line,
+    // u32 big-endian payload length followed by a serialized messages::Frame
+    LengthPrefixed,
+};
+
+namespace framing {
+
+constexpr std::size_t HEADER_SIZE = 4;
+
+inline void encodeHeader(u8* out, u32 length)
+{
+    out[0] = u8(length >> 24);
+    out[1] = u8(length >> 16);
+    out[2] = u8(length >> 8);
+    out[3] = u8(length);
+}
+
+inline u32 decodeHeader(const u8* in)
+{
+    return (u32(in[0]) << 24) | (u32(in[1]) << 16) | (u32(in[2]) << 8) | u32(in[3]);
+}
+
+inline FramingMode fromString(const std::string& mode)
+{
+    return mode == "length" ? FramingMode::LengthPrefixed : FramingMode::Line;
+}
+
+} // namespace framing
+
+#endif /* FRAMING_HPP_ */
@@ -0,0 +1,93 @@
+#include "server/network/IdleMonitor.hpp"
+
+#include <algorithm>
+
+#include <asio/co_spawn.hpp>
+#include <asio/detached.hpp>
+#include <asio/post.hpp>
+#include <asio/redirect_error.hpp>
+#include <asio/use_awaitable.hpp>
+
+#include "common/utils/Debug.hpp"
+#include "server/network/Session.hpp"
+
+IdleMonitor::IdleMonitor(asio::io_context& ioContext, std::chrono::milliseconds tick, std::chrono::milliseconds timeout)
+    : m_strand(asio::make_strand(ioContext))
+    , m_timer(m_strand)
+    , m_tick(std::max(tick, std::chrono::milliseconds(1)))
+    , m_timeout(timeout)
+{
+}
+
+void IdleMonitor::start()
+{
+    m_isRunning = true;
+    asio::co_spawn(m_strand, run(), asio::detached);
+}
+
+void IdleMonitor::stop()
+{
+    m_isRunning = false;
+    asio::post(m_strand, [this]() { m_timer.cancel(); });
+}
+
+void IdleMonitor::watch(std::weak_ptr<Session> session)
+{
+    asio::post(m_strand, [this, session = std::move(session)]() mutable {
+        m_wheel.schedule(std::move(session), ticksFor(m_timeout));
+    });
+}
+
+asio::awaitable<void> IdleMonitor::run()
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (m_isRunning) {
+        m_timer.expires_at(start + m_tick * (m_wheel.now() + 1));
+        asio::error_code ec;
+        co_await m_timer.async_wait(asio::redirect_error(asio::use_awaitable, ec));
+        if (!m_isRunning) {
+            break;
+        }
+
+        // catch up on ticks missed while the thread was busy
+        u64 target = (std::chrono::steady_clock::now() - start) / m_tick;
+        while (m_wheel.now() < target) {
+            advance();
+        }
+    }
+}
+
+void IdleMonitor::advance()
+{
+    const auto now = std::chrono::steady_clock::now();
+    m_wheel.advance([this, now](std::weak_ptr<Session> weak) {
+        auto session = weak.lock();
+        if (!session) {
+            return;
+        }
+
+        auto idle = std::chrono::duration_cast<std::chrono::milliseconds>(now - session->lastActivity());
+        if (idle >= m_timeout) {
+            m_expired.push_back(std::move(session));
+        } else {
+            // heard from since it was scheduled, check again when it could next time out
+            m_wheel.schedule(std::move(weak), ticksFor(m_timeout - idle));
+        }
+    });
+
+    if (m_expired.empty()) {
+        return;
+    }
+
+    logDebug() << "IdleMonitor: closing" << m_expired.size() << "idle session(s).";
+    for (auto& session : m_expired) {
+        session->expire();
+    }
+    m_expired.clear();
+}
+
+u64 IdleMonitor::ticksFor(std::chrono::milliseconds duration) const
+{
+    // rounded up, a session is never closed before its timeout
+    return static_cast<u64>((duration + m_tick - std::chrono::milliseconds(1)) / m_tick);
+}
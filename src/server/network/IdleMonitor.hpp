@@ -0,0 +1,54 @@
+#ifndef IDLEMONITOR_HPP_
+#define IDLEMONITOR_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <asio/awaitable.hpp>
+#include <asio/io_context.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/strand.hpp>
+
+#include "common/utils/IntTypes.hpp"
+#include "server/network/TimingWheel.hpp"
+
+class Session;
+
+/*
+ * Closes the sessions of one io_context that have gone quiet for longer than
+ * the timeout. Sessions only stamp their last activity, the wheel entry is
+ * re-armed lazily when it comes due, so traffic never touches the monitor.
+ */
+class IdleMonitor {
+public:
+    IdleMonitor(asio::io_context& ioContext, std::chrono::milliseconds tick, std::chrono::milliseconds timeout);
+
+    IdleMonitor(const IdleMonitor&) = delete;
+    IdleMonitor& operator=(const IdleMonitor&) = delete;
+
+    void start();
+    void stop();
+
+    // Safe to call from any thread.
+    void watch(std::weak_ptr<Session> session);
+
+private:
+    asio::awaitable<void> run();
+    void advance();
+    u64 ticksFor(std::chrono::milliseconds duration) const;
+
+private:
+    asio::strand<asio::io_context::executor_type> m_strand;
+    asio::steady_timer m_timer;
+    std::chrono::milliseconds m_tick;
+    std::chrono::milliseconds m_timeout;
+    std::atomic<bool> m_isRunning = false;
+
+    TimingWheel<std::weak_ptr<Session>> m_wheel;
+    // sessions expired in the current tick, closed together
+    std::vector<std::shared_ptr<Session>> m_expired;
+};
+
+#endif /* IDLEMONITOR_HPP_ */
@@ -0,0 +1,55 @@
+#ifndef MESSAGEBUFFER_HPP_
+#define MESSAGEBUFFER_HPP_
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/*
+ * Refcounted, immutable outgoing payload.
+ * Copies only bump the refcount, so one serialized payload can sit in any
+ * number of session write queues and is freed after the last write completes.
+ */
+class MessageBuffer {
+public:
+    MessageBuffer() = default;
+
+    MessageBuffer(std::string_view data)
+        : m_data(std::make_shared_for_overwrite<char[]>(data.size()))
+        , m_size(data.size())
+    {
+        std::memcpy(m_data.get(), data.data(), data.size());
+    }
+
+    MessageBuffer(const std::string& data)
+        : MessageBuffer(std::string_view(data))
+    {
+    }
+
+    MessageBuffer(const char* data)
+        : MessageBuffer(std::string_view(data))
+    {
+    }
+
+    // Lets fill write the payload in place, the buffer is immutable afterwards.
+    template <typename Fill>
+    MessageBuffer(std::size_t size, Fill&& fill)
+        : m_data(std::make_shared_for_overwrite<char[]>(size))
+        , m_size(size)
+    {
+        fill(m_data.get());
+    }
+
+    const char* data() const { return m_data.get(); }
+    std::size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    std::string_view view() const { return { m_data.get(), m_size }; }
+
+private:
+    std::shared_ptr<char[]> m_data;
+    std::size_t m_size = 0;
+};
+
+#endif /* MESSAGEBUFFER_HPP_ */
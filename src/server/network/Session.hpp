@@ -1,21 +1,38 @@
 #ifndef SESSION_HPP_
 #define SESSION_HPP_
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <deque>
 #include <memory>
+#include <vector>
 
 #include <asio/awaitable.hpp>
+#include <asio/post.hpp>
 #include <asio/co_spawn.hpp>
 #include <asio/detached.hpp>
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
+#include <asio/read.hpp>
 #include <asio/read_until.hpp>
 #include <asio/redirect_error.hpp>
 #include <asio/strand.hpp>
 #include <asio/write.hpp>
 
+#include <concurrentqueue.h>
+
+#include "common/proto/protobuf/messages.pb.h"
+#include "common/utils/Debug.hpp"
+#include "server/core/ServerConfig.hpp"
+#include "server/core/ThreadPool.hpp"
 #include "server/network/ClientInfo.hpp"
 #include "server/network/ClientManager.hpp"
+#include "server/network/FrameCodec.hpp"
+#include "server/network/Framing.hpp"
+#include "server/network/MessageBuffer.hpp"
+#include "server/network/TokenValidator.hpp"
 
 using asio::awaitable;
 using asio::co_spawn;
@@ -26,21 +43,85 @@ using asio::ip::tcp;
 
 class Session : public ClientInfo, public std::enable_shared_from_this<Session> {
 public:
-    Session(tcp::socket socket, ClientManager& clientManager)
+    Session(tcp::socket socket, ClientManager& clientManager, FramingMode framing = FramingMode::Line, IoLease lease = {})
         : m_socket(std::move(socket))
         , m_timer(m_socket.get_executor())
         , m_clientManager(clientManager)
+        , m_framing(framing)
+        , m_lease(std::move(lease))
+        , m_lastActivity(std::chrono::steady_clock::now().time_since_epoch().count())
     {
         m_timer.expires_at(std::chrono::steady_clock::time_point::max());
     }
 
     void sessionStart()
+    {
+        if (TokenValidator::isEnabled()) {
+            // ServerApplication refuses that setup, never let one through anyway
+            if (m_framing != FramingMode::LengthPrefixed) {
+                m_socket.close();
+                return;
+            }
+            co_spawn(
+                m_socket.get_executor(),
+                [self = shared_from_this()] { return self->handshake(); },
+                detached);
+            return;
+        }
+        startClient();
+    }
+
+    using ClientInfo::send;
+
+    // Safe to call from any thread: messages go through a lock-free inbox
+    // that only the session strand drains.
+    void send(MessageBuffer msg) override
+    {
+        m_inbox.enqueue(std::move(msg));
+        notifyWriter();
+    }
+
+    // Called for every session at the end of a tick, one load for sessions
+    // that hold nothing back.
+    void flush() override
+    {
+        if (m_writerState.load(std::memory_order_acquire) != WriterState::Delaying && m_inbox.size_approx() == 0)
+            return;
+        m_flushRequested.store(true, std::memory_order_release);
+        notifyWriter();
+    }
+
+    // When the peer was last heard from, read by the IdleMonitor.
+    std::chrono::steady_clock::time_point lastActivity() const
+    {
+        return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(m_lastActivity.load(std::memory_order_relaxed)));
+    }
+
+    void close() override
+    {
+        asio::post(m_socket.get_executor(), [self = shared_from_this()] { self->stop(); });
+    }
+
+    // Closes a session that timed out, safe to call from any thread.
+    void expire()
+    {
+        asio::post(m_socket.get_executor(), [self = shared_from_this()] {
+            logEvent(LogLevel::Debug, "Session: client {} timed out.", self->getId());
+            self->stop();
+        });
+    }
+
+private:
+    // Registers the client and starts the read and write loops.
+    void startClient()
     {
         m_clientManager.addClient(shared_from_this());
 
         co_spawn(
             m_socket.get_executor(),
-            [self = shared_from_this()] { return self->reader(); },
+            [self = shared_from_this()] {
+                return self->m_framing == FramingMode::LengthPrefixed ? self->frameReader() : self->reader();
+            },
             detached);
 
         co_spawn(
@@ -49,19 +130,144 @@ public:
             detached);
     }
 
-    void send(const std::string& msg)
+    // The first frame has to be a MSG_CLIENT_CONNECT with a valid token and
+    // arrive within network_connect_timeout_ms. Until then the socket is
+    // not registered, nothing it sends reaches ClientManager or the bus.
+    awaitable<void> handshake()
+    {
+        // m_timer is free until the writer starts
+        m_timer.expires_after(std::chrono::milliseconds(ServerConfig::network_connect_timeout_ms));
+        m_timer.async_wait([self = shared_from_this()](const asio::error_code& ec) {
+            if (!ec && !self->m_connected) {
+                logEvent(LogLevel::Debug, "Session: connect deadline passed, closing.");
+                self->m_socket.close();
+            }
+        });
+
+        auto status = messages::STAT_CLIENT_INVALID;
+        s64 clientId = 0;
+        try {
+            std::array<u8, framing::HEADER_SIZE> header;
+            co_await asio::async_read(m_socket, asio::buffer(header), use_awaitable);
+
+            u32 length = framing::decodeHeader(header.data());
+            if (length <= CONNECT_FRAME_LIMIT) {
+                m_readBuffer.resize(length);
+                co_await asio::async_read(m_socket, asio::buffer(m_readBuffer.data(), length), use_awaitable);
+                status = checkConnect(length, clientId);
+            }
+        } catch (std::exception&) {
+            // timed out or the peer went away, it was never registered; the
+            // pending deadline holds a reference, release it now
+            m_timer.cancel();
+            m_socket.close();
+            co_return;
+        }
+
+        m_connected = status == messages::STAT_OK;
+        m_timer.expires_at(std::chrono::steady_clock::time_point::max());
+
+        messages::ClientConnectResponse response;
+        response.set_statuscode(status);
+        messages::Frame frame;
+        frame.set_msgid(m_connected ? messages::MSG_CLIENT_OK : messages::MSG_CLIENT_REFUSED);
+        response.SerializeToString(frame.mutable_data());
+        MessageBuffer reply = framing::encodeFrame(frame);
+
+        // the writer isn't running yet, the reply goes out directly
+        std::array<u8, framing::HEADER_SIZE> replyHeader;
+        framing::encodeHeader(replyHeader.data(), static_cast<u32>(reply.size()));
+        std::array<asio::const_buffer, 2> buffers { asio::buffer(replyHeader), asio::buffer(reply.data(), reply.size()) };
+        asio::error_code ec;
+        co_await asio::async_write(m_socket, buffers, redirect_error(use_awaitable, ec));
+
+        if (!m_connected || ec) {
+            logEvent(LogLevel::Debug, "Session: connect refused, status {}.", static_cast<int>(status));
+            m_socket.close();
+            co_return;
+        }
+
+        // registered under the identity the token proved
+        setId(clientId);
+        logEvent(LogLevel::Debug, "Session: client {} authenticated.", clientId);
+        startClient();
+    }
+
+    messages::STATUS_CODE checkConnect(u32 length, s64& clientId)
     {
-        m_msgs.push_back(msg);
-        m_timer.cancel_one();
+        messages::Frame frame;
+        messages::ClientConnectRequest request;
+        if (!frame.ParseFromArray(m_readBuffer.data(), static_cast<int>(length))
+            || frame.msgid() != messages::MSG_CLIENT_CONNECT
+            || !request.ParseFromString(frame.data())) {
+            return messages::STAT_CLIENT_INVALID;
+        }
+
+        clientId = request.clientid();
+        // 0 stands for a client ClientManager still has to name
+        if (clientId <= 0) {
+            return messages::STAT_CLIENT_INVALID;
+        }
+        switch (TokenValidator::validate(clientId, request.token())) {
+        case TokenStatus::Valid:
+            return messages::STAT_OK;
+        case TokenStatus::Expired:
+            return messages::STAT_TOKEN_EXPIRED;
+        case TokenStatus::Invalid:
+            break;
+        }
+        return messages::STAT_TOKEN_INVALID;
+    }
+
+    enum class WriterState : u8 {
+        Idle,
+        Delaying,
+        Writing,
+    };
+
+    // At most one wakeup is in flight per session, however many threads send.
+    void notifyWriter()
+    {
+        if (!m_writerNotified.exchange(true, std::memory_order_acq_rel)) {
+            asio::post(m_socket.get_executor(), [self = shared_from_this()] { self->onWriterNotified(); });
+        }
+    }
+
+    void onWriterNotified()
+    {
+        m_writerNotified.exchange(false, std::memory_order_acq_rel);
+        drainInbox();
+
+        // the writer sleeps on m_timer while the queue is empty, or while it
+        // is holding a batch back for network_write_delay_us
+        if (m_writerState == WriterState::Idle
+            || (m_writerState == WriterState::Delaying
+                && (m_flushRequested.load(std::memory_order_acquire)
+                    || m_queuedBytes >= ServerConfig::network_write_max_bytes)))
+            m_timer.cancel_one();
+    }
+
+    void touch()
+    {
+        m_lastActivity.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    void drainInbox()
+    {
+        MessageBuffer msg;
+        while (m_inbox.try_dequeue(msg)) {
+            m_queuedBytes += msg.size();
+            m_msgs.push_back(std::move(msg));
+        }
     }
 
-private:
     awaitable<void> reader()
     {
         try {
             for (std::string read_msg;;) {
                 std::size_t n = co_await asio::async_read_until(m_socket,
                     asio::dynamic_buffer(read_msg, 1024), "\n", use_awaitable);
+                touch();
                 m_clientManager.onMessageReceived(shared_from_this(), read_msg.substr(0, n - 1));
                 read_msg.erase(0, n);
             }
@@ -70,16 +276,106 @@ private:
         }
     }
 
+    awaitable<void> frameReader()
+    {
+        try {
+            std::size_t filled = 0;
+            for (;;) {
+                // m_readBuffer only ever grows, so steady state reads don't allocate
+                if (m_readBuffer.size() < filled + READ_CHUNK_SIZE)
+                    m_readBuffer.resize(filled + READ_CHUNK_SIZE);
+
+                filled += co_await m_socket.async_read_some(
+                    asio::buffer(m_readBuffer.data() + filled, m_readBuffer.size() - filled), use_awaitable);
+                touch();
+
+                std::size_t consumed = 0;
+                if (!dispatchFrames(filled, consumed))
+                    break;
+
+                // keep the incomplete tail at the front for the next read
+                if (consumed > 0) {
+                    std::memmove(m_readBuffer.data(), m_readBuffer.data() + consumed, filled - consumed);
+                    filled -= consumed;
+                }
+            }
+        } catch (std::exception&) {
+        }
+        stop();
+    }
+
+    // Decodes and dispatches every complete frame in the first filled bytes
+    // of m_readBuffer as one batch, false if the stream has to be dropped.
+    bool dispatchFrames(std::size_t filled, std::size_t& consumed)
+    {
+        auto& decoder = FrameDecoder::local();
+        bool ok = true;
+        while (filled - consumed >= framing::HEADER_SIZE) {
+            u32 length = framing::decodeHeader(m_readBuffer.data() + consumed);
+            if (length > ServerConfig::network_max_frame_size) {
+                logWarning() << "Session: frame of" << length << "bytes exceeds limit, closing.";
+                ok = false;
+                break;
+            }
+            if (filled - consumed - framing::HEADER_SIZE < length)
+                break;
+
+            auto* frame = decoder.decode(m_readBuffer.data() + consumed + framing::HEADER_SIZE, length);
+            if (!frame) {
+                logWarning() << "Session: malformed frame, closing.";
+                ok = false;
+                break;
+            }
+            if (frame->msgid() == messages::MSG_CLIENT_HEARTBEAT) {
+                // the read already counted as activity, answer so the client
+                // can tell the server is alive too
+                sendFrame(*frame);
+            } else {
+                m_clientManager.onFrameReceived(shared_from_this(), *frame);
+            }
+            consumed += framing::HEADER_SIZE + length;
+        }
+        decoder.reset();
+        return ok;
+    }
+
     awaitable<void> writer()
     {
+        const auto delay = std::chrono::microseconds(ServerConfig::network_write_delay_us);
+        // batched frames wait for the end of the tick even without a delay
+        const bool holdForTick = ServerConfig::network_tick_ms > 0 && m_framing == FramingMode::LengthPrefixed && ServerConfig::network_batch_frames;
         try {
             while (m_socket.is_open()) {
+                drainInbox();
                 if (m_msgs.empty()) {
+                    m_writerState = WriterState::Idle;
                     asio::error_code ec;
                     co_await m_timer.async_wait(redirect_error(use_awaitable, ec));
-                } else {
-                    co_await asio::async_write(m_socket,
-                        asio::buffer(m_msgs.front()), use_awaitable);
+                    continue;
+                }
+
+                if ((delay.count() > 0 || holdForTick) && !m_flushRequested.load(std::memory_order_acquire)
+                    && m_queuedBytes < ServerConfig::network_write_max_bytes) {
+                    // hold the batch until the delay runs out, flush() is called
+                    // or the queue reaches the byte cap
+                    m_writerState = WriterState::Delaying;
+                    asio::error_code ec;
+                    if (delay.count() > 0)
+                        m_timer.expires_after(delay);
+                    co_await m_timer.async_wait(redirect_error(use_awaitable, ec));
+                    m_timer.expires_at(std::chrono::steady_clock::time_point::max());
+                    if (!m_socket.is_open())
+                        break;
+                    drainInbox();
+                }
+
+                m_writerState = WriterState::Writing;
+                m_flushRequested.store(false, std::memory_order_release);
+                std::size_t count = gatherWriteBuffers();
+                co_await asio::async_write(m_socket, m_writeBuffers, use_awaitable);
+
+                for (std::size_t i = 0; i < count; ++i) {
+                    m_queuedBytes -= m_msgs.front().size();
                     m_msgs.pop_front();
                 }
             }
@@ -88,6 +384,77 @@ private:
         }
     }
 
+    // Fill m_writeBuffers with as many queued messages as the segment and
+    // byte caps allow (always at least one), returns the message count.
+    std::size_t gatherWriteBuffers()
+    {
+        if (m_framing == FramingMode::LengthPrefixed && ServerConfig::network_batch_frames)
+            return gatherBatch();
+
+        const bool prefixed = m_framing == FramingMode::LengthPrefixed;
+        const std::size_t segmentsPerMsg = prefixed ? 2 : 1;
+        const std::size_t maxSegments = std::max<std::size_t>(ServerConfig::network_write_max_segments, segmentsPerMsg);
+
+        std::size_t count = 0;
+        std::size_t bytes = 0;
+        for (const auto& msg : m_msgs) {
+            if (count > 0
+                && ((count + 1) * segmentsPerMsg > maxSegments
+                    || bytes + msg.size() > ServerConfig::network_write_max_bytes))
+                break;
+            bytes += msg.size();
+            ++count;
+        }
+
+        // headers are sized up front so the buffers below never dangle
+        m_writeBuffers.clear();
+        if (prefixed)
+            m_writeHeaders.resize(count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto& msg = m_msgs[i];
+            if (prefixed) {
+                framing::encodeHeader(m_writeHeaders[i].data(), static_cast<u32>(msg.size()));
+                m_writeBuffers.push_back(asio::buffer(m_writeHeaders[i]));
+            }
+            m_writeBuffers.push_back(asio::buffer(msg.data(), msg.size()));
+        }
+
+        return count;
+    }
+
+    // Everything the session was sent this tick, up to the byte cap, goes
+    // out as one MSG_SERVER_BATCH frame with the next sequence number. A
+    // lone frame is cheaper without the container and goes out as is.
+    std::size_t gatherBatch()
+    {
+        std::size_t count = 0;
+        std::size_t bytes = 0;
+        for (const auto& msg : m_msgs) {
+            if (count > 0 && bytes + msg.size() > ServerConfig::network_write_max_bytes)
+                break;
+            bytes += msg.size();
+            ++count;
+        }
+
+        m_writeHeaders.resize(1);
+        m_writeBuffers.clear();
+        if (count == 1) {
+            framing::encodeHeader(m_writeHeaders[0].data(), static_cast<u32>(m_msgs.front().size()));
+            m_writeBuffers.push_back(asio::buffer(m_writeHeaders[0]));
+            m_writeBuffers.push_back(asio::buffer(m_msgs.front().data(), m_msgs.front().size()));
+            return count;
+        }
+
+        m_writeBatch = framing::encodeBatch(m_msgs, count, static_cast<s32>(++m_batchSequence), ServerConfig::network_batch_compress_threshold);
+
+        framing::encodeHeader(m_writeHeaders[0].data(), static_cast<u32>(m_writeBatch.size()));
+        m_writeBuffers.push_back(asio::buffer(m_writeHeaders[0]));
+        m_writeBuffers.push_back(asio::buffer(m_writeBatch.data(), m_writeBatch.size()));
+
+        return count;
+    }
+
     void stop()
     {
         m_clientManager.removeClient(shared_from_this());
@@ -96,10 +463,44 @@ private:
     }
 
 private:
+    // a single moodycamel block, the default preallocates six per session
+    static constexpr std::size_t INBOX_INITIAL_CAPACITY = 32;
+    static constexpr std::size_t READ_CHUNK_SIZE = 4096;
+    // a connect request is an id and a token, no unauthenticated socket
+    // gets to make the session buffer a full frame
+    static constexpr u32 CONNECT_FRAME_LIMIT = 64 + TokenValidator::MAX_TOKEN_LENGTH;
+
     tcp::socket m_socket;
     asio::steady_timer m_timer;
     ClientManager& m_clientManager;
-    std::deque<std::string> m_msgs;
+
+    // m_inbox is the only part of the write path touched off the strand
+    moodycamel::ConcurrentQueue<MessageBuffer> m_inbox { INBOX_INITIAL_CAPACITY };
+    std::atomic<bool> m_writerNotified = false;
+    std::atomic<bool> m_flushRequested = false;
+
+    std::deque<MessageBuffer> m_msgs;
+    // only written on the strand, flush() peeks at it from the ticking thread
+    std::atomic<WriterState> m_writerState = WriterState::Writing;
+
+    FramingMode m_framing;
+    std::vector<u8> m_readBuffer;
+
+    // keeps this session counted against its io_context until it is destroyed
+    IoLease m_lease;
+    // set once the handshake passed, only touched on the strand
+    bool m_connected = false;
+
+    // steady_clock ticks, written by the readers and read by the IdleMonitor
+    std::atomic<std::chrono::steady_clock::rep> m_lastActivity;
+
+    std::size_t m_queuedBytes = 0;
+    std::vector<asio::const_buffer> m_writeBuffers;
+    std::vector<std::array<u8, framing::HEADER_SIZE>> m_writeHeaders;
+
+    // container being written when frames are batched, and its frameId
+    MessageBuffer m_writeBatch;
+    u32 m_batchSequence = 0;
 };
 
 #endif
\ No newline at end of file
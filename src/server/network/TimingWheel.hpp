@@ -0,0 +1,94 @@
+#ifndef TIMINGWHEEL_HPP_
+#define TIMINGWHEEL_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "common/utils/IntTypes.hpp"
+
+/*
+ * Hierarchical timing wheel: LEVELS rings of SLOTS buckets, each level a
+ * SLOTS times coarser than the one below. Scheduling is O(1); an item is
+ * cascaded down at most once per level before it expires. Not thread-safe,
+ * the owner drives it from a single strand.
+ */
+template <typename T>
+class TimingWheel {
+public:
+    static constexpr u32 SLOT_BITS = 6;
+    static constexpr u32 SLOTS = 1u << SLOT_BITS;
+    static constexpr u32 LEVELS = 4;
+    // furthest an item can be scheduled, later deadlines are clamped
+    static constexpr u64 MAX_TICKS = (u64(1) << (SLOT_BITS * LEVELS)) - 1;
+
+    // Due once advance() has been called ticks more times, at least one.
+    void schedule(T item, u64 ticks)
+    {
+        place(std::move(item), m_tick + std::clamp<u64>(ticks, 1, MAX_TICKS));
+        ++m_size;
+    }
+
+    // Moves one tick forward and hands every item that is now due to expire.
+    // expire may schedule items again.
+    template <typename Fn>
+    void advance(Fn&& expire)
+    {
+        ++m_tick;
+
+        // coarser levels first, what they cascade may land in a finer slot
+        // that is due for cascading on this same tick
+        for (u32 level = LEVELS - 1; level > 0; --level) {
+            if ((m_tick & ((u64(1) << (SLOT_BITS * level)) - 1)) != 0) {
+                continue;
+            }
+            m_due.swap(m_slots[level][slotIndex(m_tick, level)]);
+            for (auto& item : m_due) {
+                place(std::move(item.value), item.deadline);
+            }
+            m_due.clear();
+        }
+
+        m_due.swap(m_slots[0][slotIndex(m_tick, 0)]);
+        m_size -= m_due.size();
+        for (auto& item : m_due) {
+            expire(std::move(item.value));
+        }
+        m_due.clear();
+    }
+
+    u64 now() const { return m_tick; }
+    std::size_t size() const { return m_size; }
+
+private:
+    struct Entry {
+        T value;
+        u64 deadline;
+    };
+
+    static std::size_t slotIndex(u64 tick, u32 level)
+    {
+        return (tick >> (SLOT_BITS * level)) & (SLOTS - 1);
+    }
+
+    void place(T item, u64 deadline)
+    {
+        u64 delta = deadline - m_tick;
+        u32 level = 0;
+        while (level + 1 < LEVELS && delta >= (u64(1) << (SLOT_BITS * (level + 1)))) {
+            ++level;
+        }
+        m_slots[level][slotIndex(deadline, level)].push_back({ std::move(item), deadline });
+    }
+
+private:
+    std::array<std::array<std::vector<Entry>, SLOTS>, LEVELS> m_slots;
+    // swapped with the slot being processed, keeps both allocations alive
+    std::vector<Entry> m_due;
+    u64 m_tick = 0;
+    std::size_t m_size = 0;
+};
+
+#endif /* TIMINGWHEEL_HPP_ */
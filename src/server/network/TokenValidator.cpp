@@ -0,0 +1,139 @@
+#include "server/network/TokenValidator.hpp"
+
+#include <charconv>
+#include <chrono>
+#include <list>
+#include <unordered_map>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+std::string TokenValidator::s_secret;
+u32 TokenValidator::s_cacheSize = 4096;
+
+namespace {
+
+struct Verdict {
+    bool signatureOk = false;
+    s64 clientId = 0;
+    s64 expiresAt = 0;
+};
+
+template <typename T>
+bool parseNumber(std::string_view text, T& value)
+{
+    auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+    return result.ec == std::errc() && result.ptr == text.data() + text.size();
+}
+
+/*
+ * Least recently used first out. Keys point into the list nodes, which never
+ * move, so a lookup doesn't build a std::string. Only holds tokens of at most
+ * MAX_TOKEN_LENGTH with a valid signature, forged ones can't crowd it.
+ */
+class ValidationCache {
+public:
+    explicit ValidationCache(std::size_t capacity)
+        : m_capacity(capacity)
+    {
+    }
+
+    const Verdict* find(std::string_view token)
+    {
+        auto it = m_index.find(token);
+        if (it == m_index.end()) {
+            return nullptr;
+        }
+        m_order.splice(m_order.begin(), m_order, it->second);
+        return &it->second->verdict;
+    }
+
+    void insert(std::string_view token, const Verdict& verdict)
+    {
+        if (m_capacity == 0) {
+            return;
+        }
+        if (m_index.size() >= m_capacity) {
+            m_index.erase(m_order.back().token);
+            m_order.pop_back();
+        }
+        m_order.push_front({ std::string(token), verdict });
+        m_index.emplace(m_order.front().token, m_order.begin());
+    }
+
+private:
+    struct Node {
+        std::string token;
+        Verdict verdict;
+    };
+
+    std::size_t m_capacity;
+    std::list<Node> m_order;
+    std::unordered_map<std::string_view, std::list<Node>::iterator> m_index;
+};
+
+} // namespace
+
+void TokenValidator::init(std::string secret, u32 cacheSize)
+{
+    s_secret = std::move(secret);
+    s_cacheSize = cacheSize;
+}
+
+std::string TokenValidator::issue(s64 clientId, s64 expiresAt)
+{
+    std::string payload = std::to_string(clientId) + "." + std::to_string(expiresAt);
+    return payload + "." + sign(payload);
+}
+
+TokenStatus TokenValidator::validate(s64 clientId, std::string_view token)
+{
+    if (token.size() > MAX_TOKEN_LENGTH) {
+        return TokenStatus::Invalid;
+    }
+
+    thread_local ValidationCache cache(s_cacheSize);
+
+    const Verdict* verdict = cache.find(token);
+    Verdict fresh;
+    if (!verdict) {
+        auto signatureAt = token.rfind('.');
+        auto expiryAt = signatureAt == std::string_view::npos ? std::string_view::npos : token.rfind('.', signatureAt - 1);
+        if (expiryAt != std::string_view::npos && signatureAt > 0
+            && parseNumber(token.substr(0, expiryAt), fresh.clientId)
+            && parseNumber(token.substr(expiryAt + 1, signatureAt - expiryAt - 1), fresh.expiresAt)) {
+            std::string expected = sign(token.substr(0, signatureAt));
+            std::string_view signature = token.substr(signatureAt + 1);
+            fresh.signatureOk = signature.size() == expected.size()
+                && CRYPTO_memcmp(signature.data(), expected.data(), expected.size()) == 0;
+        }
+        if (fresh.signatureOk) {
+            cache.insert(token, fresh);
+        }
+        verdict = &fresh;
+    }
+
+    if (!verdict->signatureOk || verdict->clientId != clientId) {
+        return TokenStatus::Invalid;
+    }
+
+    s64 now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    return verdict->expiresAt > now ? TokenStatus::Valid : TokenStatus::Expired;
+}
+
+std::string TokenValidator::sign(std::string_view payload)
+{
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int length = 0;
+    HMAC(EVP_sha256(), s_secret.data(), static_cast<int>(s_secret.size()),
+        reinterpret_cast<const unsigned char*>(payload.data()), payload.size(), digest, &length);
+
+    constexpr char HEX[] = "0123456789abcdef";
+    std::string signature(length * 2, '\0');
+    for (unsigned int i = 0; i < length; ++i) {
+        signature[2 * i] = HEX[digest[i] >> 4];
+        signature[2 * i + 1] = HEX[digest[i] & 0xf];
+    }
+    return signature;
+}
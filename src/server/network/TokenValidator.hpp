@@ -0,0 +1,44 @@
+#ifndef TOKENVALIDATOR_HPP_
+#define TOKENVALIDATOR_HPP_
+
+#include <string>
+#include <string_view>
+
+#include "common/utils/IntTypes.hpp"
+
+enum class TokenStatus : u8 {
+    Valid,
+    Invalid,
+    Expired,
+};
+
+/*
+ * Connect tokens are "<clientId>.<expiry, unix seconds>.<signature>", the
+ * signature being the hex HMAC-SHA256 of the first two fields under the
+ * server secret, so checking one needs no outside lookup. Tokens whose
+ * signature checked out are kept in a per-thread LRU cache; a reconnect storm
+ * with the same tokens doesn't redo the HMAC and takes no lock.
+ */
+class TokenValidator {
+public:
+    // two s64 fields, two dots and 64 hex digits fit with room to spare;
+    // anything longer is refused before it is parsed
+    static constexpr std::size_t MAX_TOKEN_LENGTH = 128;
+
+    // must run before any session connects, an empty secret disables the handshake
+    static void init(std::string secret, u32 cacheSize);
+
+    static bool isEnabled() { return !s_secret.empty(); }
+
+    static std::string issue(s64 clientId, s64 expiresAt);
+    static TokenStatus validate(s64 clientId, std::string_view token);
+
+private:
+    static std::string sign(std::string_view payload);
+
+private:
+    static std::string s_secret;
+    static u32 s_cacheSize;
+};
+
+#endif /* TOKENVALIDATOR_HPP_ */
@@ -1,27 +1,79 @@
 #include "server/services/ConnectionService.hpp"
+
+#include <algorithm>
+
+#include <sys/socket.h>
+
+#include <asio/co_spawn.hpp>
+#include <asio/detached.hpp>
+#include <asio/post.hpp>
+#include <asio/redirect_error.hpp>
+#include <asio/socket_base.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/strand.hpp>
+#include <asio/this_coro.hpp>
+#include <asio/use_awaitable.hpp>
+
 #include "common/utils/Debug.hpp"
+#include "server/core/ServerConfig.hpp"
 #include "server/network/Session.hpp"
 
-void ConnectionService::init(u16 port)
+using ReusePort = asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+
+void ConnectionService::init(u16 port, FramingMode framing)
 {
     m_port = port;
+    m_framing = framing;
+
+    // set up here, before the pool runs, so stop() never races start() on them
+    const u32 acceptors = std::max(1u, ServerConfig::network_acceptors);
+    try {
+        // with several acceptors there is one listening socket per io_context,
+        // the kernel spreads incoming connections across them
+        for (u32 i = 0; i < acceptors; ++i) {
+            std::size_t index = i % m_threadPool.getIoContextCount();
+            m_acceptors.push_back(openAcceptor(m_threadPool.getIoContext(index), acceptors > 1));
+        }
+    } catch (const std::exception& e) {
+        logError() << "Failed to listen on port" << m_port << ":" << e.what();
+        m_acceptors.clear();
+        return;
+    }
+
+    if (ServerConfig::network_heartbeat_timeout_ms > 0) {
+        for (std::size_t i = 0; i < m_threadPool.getIoContextCount(); ++i) {
+            m_idleMonitors.push_back(std::make_unique<IdleMonitor>(m_threadPool.getIoContext(i),
+                std::chrono::milliseconds(ServerConfig::network_heartbeat_tick_ms),
+                std::chrono::milliseconds(ServerConfig::network_heartbeat_timeout_ms)));
+        }
+    }
+
     logDebug() << "ConnectionService initialized.";
 }
 
 awaitable<void> ConnectionService::start()
 {
-    if (!isInitialized()) {
+    if (!isInitialized() || m_acceptors.empty()) {
         logDebug() << "ConnectionService not initialized.";
         co_return;
     }
 
-    logInfo() << "Start listening on port" << m_port << ".";
+    const u32 acceptors = static_cast<u32>(m_acceptors.size());
+    logInfo() << "Start listening on port" << m_port << "with" << acceptors << "acceptor(s).";
     m_isRunning = true;
-    tcp::acceptor acceptor(m_threadPool.getIoContext(), { tcp::v4(), m_port });
-    while (m_isRunning) {
-        std::make_shared<Session>(co_await acceptor.async_accept(use_awaitable),
-            m_clientManager)
-            ->sessionStart();
+
+    for (auto& monitor : m_idleMonitors) {
+        monitor->start();
+    }
+
+    // only writers that hold frames back need the end of tick flush
+    if (ServerConfig::network_tick_ms > 0 && (ServerConfig::network_write_delay_us > 0 || ServerConfig::network_batch_frames)) {
+        co_spawn(getExecutor(), tickLoop(), detached);
+    }
+
+    for (std::size_t i = 0; i < m_acceptors.size(); ++i) {
+        auto ioIndex = acceptors > 1 ? std::optional<std::size_t>(i % m_threadPool.getIoContextCount()) : std::nullopt;
+        co_spawn(m_acceptors[i]->get_executor(), acceptLoop(*m_acceptors[i], ioIndex), detached);
     }
 
     co_return;
@@ -30,5 +82,87 @@ awaitable<void> ConnectionService::start()
 void ConnectionService::stop()
 {
     m_isRunning = false;
+    // wakes the parked async_accept, closed on the acceptor's own strand
+    for (auto& acceptor : m_acceptors) {
+        asio::post(acceptor->get_executor(), [&acceptor = *acceptor]() {
+            asio::error_code ec;
+            acceptor.close(ec);
+        });
+    }
+    for (auto& monitor : m_idleMonitors) {
+        monitor->stop();
+    }
     logDebug() << "ConnectionService stopped.";
-}
\ No newline at end of file
+}
+
+std::unique_ptr<tcp::acceptor> ConnectionService::openAcceptor(asio::io_context& ioContext, bool reusePort)
+{
+    tcp::endpoint endpoint(tcp::v4(), m_port);
+    auto acceptorPtr = std::make_unique<tcp::acceptor>(asio::make_strand(ioContext));
+    auto& acceptor = *acceptorPtr;
+
+    acceptor.open(endpoint.protocol());
+    acceptor.set_option(tcp::acceptor::reuse_address(true));
+    if (reusePort) {
+        acceptor.set_option(ReusePort(true));
+    }
+
+    // set before listen so accepted sockets inherit them and the receive
+    // window scale is negotiated for the configured size
+    if (ServerConfig::network_socket_send_buffer > 0) {
+        acceptor.set_option(asio::socket_base::send_buffer_size(ServerConfig::network_socket_send_buffer));
+    }
+    if (ServerConfig::network_socket_recv_buffer > 0) {
+        acceptor.set_option(asio::socket_base::receive_buffer_size(ServerConfig::network_socket_recv_buffer));
+    }
+
+    acceptor.bind(endpoint);
+    acceptor.listen(ServerConfig::network_accept_backlog);
+    return acceptorPtr;
+}
+
+awaitable<void> ConnectionService::acceptLoop(tcp::acceptor& acceptor, std::optional<std::size_t> ioIndex)
+{
+    try {
+        while (m_isRunning) {
+            auto lease = ioIndex ? m_threadPool.leaseIoContext(*ioIndex) : m_threadPool.nextIoContext();
+            // every session gets its own strand, its coroutines never run concurrently
+            tcp::socket socket = co_await acceptor.async_accept(asio::make_strand(lease.ioContext()), use_awaitable);
+            configureSocket(socket);
+
+            std::size_t index = lease.index();
+            auto session = std::make_shared<Session>(std::move(socket), m_clientManager, m_framing, std::move(lease));
+            session->sessionStart();
+            if (!m_idleMonitors.empty()) {
+                m_idleMonitors[index]->watch(session);
+            }
+        }
+    } catch (const std::exception& e) {
+        // stop() closing the acceptor lands here too
+        if (m_isRunning) {
+            logError() << "Acceptor stopped:" << e.what();
+        }
+    }
+}
+
+awaitable<void> ConnectionService::tickLoop()
+{
+    asio::steady_timer timer(co_await asio::this_coro::executor);
+    const auto tick = std::chrono::milliseconds(ServerConfig::network_tick_ms);
+    auto next = std::chrono::steady_clock::now();
+    while (m_isRunning) {
+        next += tick;
+        timer.expires_at(next);
+        asio::error_code ec;
+        co_await timer.async_wait(redirect_error(use_awaitable, ec));
+        m_clientManager.flush();
+    }
+}
+
+void ConnectionService::configureSocket(tcp::socket& socket)
+{
+    // failures only cost latency, the connection is still usable
+    asio::error_code ec;
+    socket.set_option(tcp::no_delay(ServerConfig::network_tcp_nodelay), ec);
+    socket.set_option(asio::socket_base::keep_alive(ServerConfig::network_tcp_keepalive), ec);
+}
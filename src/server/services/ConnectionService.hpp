@@ -1,31 +1,52 @@
 #ifndef CONNECTIONSERVICE_HPP_
 #define CONNECTIONSERVICE_HPP_
 
+#include <atomic>
 #include <memory>
+#include <optional>
+#include <vector>
+
+#include <asio/ip/tcp.hpp>
 
 #include "common/utils/IntTypes.hpp"
 #include "server/core/MessageBus.hpp"
 #include "server/network/ClientManager.hpp"
+#include "server/network/Framing.hpp"
+#include "server/network/IdleMonitor.hpp"
 #include "server/services/Service.hpp"
 
 #define _SERVICE_NAME "ConnectionService"
 
 class ConnectionService : public Service, public std::enable_shared_from_this<ConnectionService> {
 public:
-    ConnectionService(ThreadPool& threadPool, MessageBus& messageBus)
-        : Service(threadPool, _SERVICE_NAME)
-        , m_clientManager(messageBus) {};
-    void init(u16 m_port);
+    ConnectionService(ThreadPool& threadPool, MessageBus& messageBus, const MessageRegistry& messageRegistry)
+        : Service(threadPool, ServiceId::Connection, _SERVICE_NAME)
+        , m_clientManager(messageBus, messageRegistry) {};
+    void init(u16 m_port, FramingMode framing = FramingMode::Line);
     bool isInitialized() { return m_port != 0; }
 
     awaitable<void> start() override;
     void stop() override;
 
+private:
+    std::unique_ptr<asio::ip::tcp::acceptor> openAcceptor(asio::io_context& ioContext, bool reusePort);
+    // With an index, accepted sockets stay on that io_context; otherwise the
+    // thread pool places them.
+    awaitable<void> acceptLoop(asio::ip::tcp::acceptor& acceptor, std::optional<std::size_t> ioIndex);
+    void configureSocket(asio::ip::tcp::socket& socket);
+    // Flushes every client at the end of each network tick.
+    awaitable<void> tickLoop();
+
 private:
     u16 m_port = 0;
-    bool m_isRunning = false;
+    FramingMode m_framing = FramingMode::Line;
+    std::atomic<bool> m_isRunning = false;
+    // kept so stop() can close them, each runs on its own strand
+    std::vector<std::unique_ptr<asio::ip::tcp::acceptor>> m_acceptors;
 
     ClientManager m_clientManager;
+    // one per io_context, empty when idle timeouts are off
+    std::vector<std::unique_ptr<IdleMonitor>> m_idleMonitors;
 };
 
 #endif /* CONNECTIONSERVICE_HPP_ */
\ No newline at end of file
@@ -1,44 +1,99 @@
 #include "server/services/EchoService.hpp"
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <chrono>
+#include <string_view>
 
 #include <asio/awaitable.hpp>
 #include <asio/co_spawn.hpp>
 #include <asio/detached.hpp>
+#include <asio/steady_timer.hpp>
+#include <asio/this_coro.hpp>
+#include <asio/use_awaitable.hpp>
+
+#include "server/core/MessageRegistry.hpp"
 
 asio::awaitable<void> EchoService::start()
 {
     m_isRunning = true;
     while (m_isRunning) {
-        std::lock_guard<std::mutex> lock(m_messageQueueMutex);
-        if (m_messageQueue.empty()) {
-            continue;
+        auto message = co_await receiveMessage();
+        if (!message) {
+            break;
         }
-        auto message = m_messageQueue.front();
-        m_messageQueue.pop();
-
-        m_threadPool.post([this, message = std::move(message)]() {
-            auto wait_time = std::chrono::seconds(std::stoi(message.message));
-            std::this_thread::sleep_for(wait_time);
-            message.clientInfo->send("Wait and Echo: " + message.message + "s.");
-        });
+        dispatch(std::move(message));
     }
+
     co_return;
 }
 
 void EchoService::stop()
 {
     m_isRunning = false;
+    getMailbox().close();
 }
 
-void EchoService::onMessage(std::unique_ptr<CoreMessage> message)
+void EchoService::registerMessages(MessageRegistry& registry)
 {
-    try {
-        auto echoMessage = dynamic_cast<EchoMessage&>(*message);
+    registry.registerMessage<messages::MSG_ECHO, &EchoService::decodeEcho>(getId());
+}
 
-        std::lock_guard<std::mutex> lock(m_messageQueueMutex);
-        m_messageQueue.push(echoMessage);
-    } catch (const std::bad_cast& e) {
-        logError() << "EchoService received wrong message type.";
+std::unique_ptr<EchoMessage> EchoService::decodeEcho(ClientInfoPtr client, const messages::Frame& frame, const messages::Echo& echo)
+{
+    auto message = std::make_unique<EchoMessage>(std::move(client), echo.text(), ServiceId::Connection);
+    message->framed = true;
+    if (frame.has_frameid()) {
+        message->frameId = frame.frameid();
+    }
+    return message;
+}
+
+void EchoService::onEchoMessage(std::unique_ptr<EchoMessage> message)
+{
+    // every echo waits on its own timer, the consumer moves straight on
+    asio::co_spawn(m_threadPool.getIoContext(), echoAfterDelay(std::move(message)), asio::detached);
+}
+
+asio::awaitable<void> EchoService::echoAfterDelay(std::unique_ptr<EchoMessage> message)
+{
+    // the delay comes straight from the client, a bad one gets an answer
+    // instead of an exception nobody sees
+    std::string_view text = message->message;
+    // telnet clients end their lines with \r
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+        text.remove_suffix(1);
     }
-}
\ No newline at end of file
+    u32 seconds = 0;
+    auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), seconds);
+    if (text.empty() || ec != std::errc() || end != text.data() + text.size()) {
+        logEvent(LogLevel::Debug, "[EchoService] Rejected echo with a bad delay: {}", text);
+        reply(*message, "Echo: not a number of seconds.");
+        co_return;
+    }
+    seconds = std::min(seconds, MAX_DELAY_SECONDS);
+
+    asio::steady_timer timer(co_await asio::this_coro::executor, std::chrono::seconds(seconds));
+    co_await timer.async_wait(asio::use_awaitable);
+    reply(*message, "Wait and Echo: " + std::to_string(seconds) + "s.");
+}
+
+void EchoService::reply(const EchoMessage& message, std::string text)
+{
+    if (!message.framed) {
+        message.clientInfo->send(text);
+        return;
+    }
+
+    messages::Echo echo;
+    echo.set_text(std::move(text));
+
+    messages::Frame frame;
+    frame.set_msgid(messages::MSG_ECHO);
+    if (message.frameId) {
+        frame.set_frameid(*message.frameId);
+    }
+    echo.SerializeToString(frame.mutable_data());
+    message.clientInfo->sendFrame(frame);
+}
@@ -1,44 +1,56 @@
 #ifndef ECHOSERVICE_HPP_
 #define ECHOSERVICE_HPP_
 
+#include <atomic>
 #include <memory>
-#include <queue>
+#include <optional>
 
 #include "server/network/ClientInfo.hpp"
 #include "server/services/Service.hpp"
 
 #define _SERVICE_NAME "EchoService"
 
-class EchoMessage : public CoreMessage {
+class EchoMessage : public TypedMessage<MessageType::Echo> {
 public:
-    EchoMessage(std::shared_ptr<ClientInfo> _clientInfo, std::string _message, std::string _sender)
-        : message(_message)
-        , clientInfo(_clientInfo)
-        , CoreMessage(_sender, _SERVICE_NAME)
+    EchoMessage(std::shared_ptr<ClientInfo> _clientInfo, std::string _message, ServiceId _sender)
+        : TypedMessage(_sender, ServiceId::Echo)
+        , message(std::move(_message))
+        , clientInfo(std::move(_clientInfo))
     {
     }
     std::string message;
     std::shared_ptr<ClientInfo> clientInfo;
+
+    // came in as a messages::Frame, the reply goes back as one
+    bool framed = false;
+    std::optional<s32> frameId;
 };
 
 class EchoService : public Service {
 public:
     EchoService(ThreadPool& _threadPool)
-        : Service(_threadPool, _SERVICE_NAME) {};
+        : Service(_threadPool, ServiceId::Echo, _SERVICE_NAME, MailboxMode::Receive)
+    {
+        registerHandler<&EchoService::onEchoMessage>();
+    }
 
     awaitable<void> start() override;
     void stop() override;
+    void registerMessages(MessageRegistry& registry) override;
 
-public:
-    awaitable<EchoMessage> receiveMessage();
+private:
+    static std::unique_ptr<EchoMessage> decodeEcho(ClientInfoPtr client, const messages::Frame& frame, const messages::Echo& echo);
 
-public:
-    void onMessage(std::unique_ptr<CoreMessage> message) override;
+    void onEchoMessage(std::unique_ptr<EchoMessage> message);
+    awaitable<void> echoAfterDelay(std::unique_ptr<EchoMessage> message);
+    void reply(const EchoMessage& message, std::string text);
+
+private:
+    // longer delays are cut short, a client can't park timers indefinitely
+    static constexpr u32 MAX_DELAY_SECONDS = 60;
 
 private:
-    bool m_isRunning = false;
-    std::queue<EchoMessage> m_messageQueue;
-    std::mutex m_messageQueueMutex;
+    std::atomic<bool> m_isRunning = false;
 };
 
 #endif /* ECHOSERVICE_HPP_ */
\ No newline at end of file
@@ -1,21 +1,30 @@
 #ifndef SERVICE_HPP_
 #define SERVICE_HPP_
 
+#include <array>
+#include <memory>
+
 #include <asio/awaitable.hpp>
 #include <asio/io_context.hpp>
 
 #include "common/utils/Debug.hpp"
 #include "server/core/CoreMessage.hpp"
+#include "server/core/Mailbox.hpp"
+#include "server/core/ServiceId.hpp"
 #include "server/core/ThreadPool.hpp"
 
 using asio::awaitable;
 using asio::io_context;
 
+class MessageRegistry;
+
 class Service {
 public:
-    Service(ThreadPool& threadPool, const std::string& name)
+    Service(ThreadPool& threadPool, ServiceId id, const std::string& name, MailboxMode mailboxMode = MailboxMode::Dispatch)
         : m_threadPool(threadPool)
+        , m_id(id)
         , m_name(name)
+        , m_mailbox(threadPool, mailboxMode, [this](std::unique_ptr<CoreMessage> message) { dispatch(std::move(message)); })
     {
     }
     virtual ~Service() = default;
@@ -28,19 +37,66 @@ public:
     {
         logDebug() << m_name << "Service stopped.";
     }
+    // Binds the client opcodes this service handles, called once at registration.
+    virtual void registerMessages(MessageRegistry&) { }
 
 public:
+    ServiceId getId() const { return m_id; }
     std::string getName() { return m_name; }
+    Mailbox& getMailbox() { return m_mailbox; }
+    // start() is spawned here; receiveMessage() must be awaited on it
+    Mailbox::Executor getExecutor() const { return m_mailbox.getExecutor(); }
 
 public:
-    virtual void onMessage(std::unique_ptr<CoreMessage> message)
+    // One indexed call per message, no RTTI or string lookups.
+    void dispatch(std::unique_ptr<CoreMessage> message)
     {
-        logDebug() << m_name << "service received message from: " << message->sender;
-    };
+        auto handler = m_handlers[static_cast<std::size_t>(message->type)];
+        if (handler) {
+            handler(*this, std::move(message));
+        } else {
+            logDebug() << m_name << "service has no handler for message type" << static_cast<u16>(message->type);
+        }
+    }
+
+protected:
+    // Next message for a MailboxMode::Receive service, nullptr once the mailbox is closed.
+    awaitable<std::unique_ptr<CoreMessage>> receiveMessage() { return m_mailbox.receive(); }
+
+    // Binds a member function `void Derived::fn(std::unique_ptr<Msg>)` to Msg::TYPE.
+    template <auto Handler>
+    void registerHandler()
+    {
+        using Traits = HandlerTraits<decltype(Handler)>;
+        using Derived = typename Traits::Service;
+        using Msg = typename Traits::Message;
+
+        m_handlers[static_cast<std::size_t>(Msg::TYPE)] = [](Service& self, std::unique_ptr<CoreMessage> message) {
+            // the tag was set by Msg's own constructor, so the downcast is exact
+            std::unique_ptr<Msg> typed(static_cast<Msg*>(message.release()));
+            (static_cast<Derived&>(self).*Handler)(std::move(typed));
+        };
+    }
 
 protected:
-    std::string m_name;
     ThreadPool& m_threadPool;
+    ServiceId m_id;
+    std::string m_name;
+
+private:
+    template <typename T>
+    struct HandlerTraits;
+
+    template <typename S, typename M>
+    struct HandlerTraits<void (S::*)(std::unique_ptr<M>)> {
+        using Service = S;
+        using Message = M;
+    };
+
+    using DispatchFn = void (*)(Service&, std::unique_ptr<CoreMessage>);
+
+    std::array<DispatchFn, MESSAGE_TYPE_COUNT> m_handlers {};
+    Mailbox m_mailbox;
 };
 
-#endif /* SERVICE_HPP_ */
\ No newline at end of file
+#endif /* SERVICE_HPP_ */
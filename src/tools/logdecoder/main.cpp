@@ -0,0 +1,152 @@
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <zlib.h>
+
+#include "common/logger/BinaryLog.hpp"
+#include "common/utils/Utils.hpp"
+
+/*
+ * Renders a binary log (log_file_format = "binary") back to text.
+ *   logdecoder <file.blog> [-l]
+ * -l also prints the file:line of every call site.
+ */
+
+namespace {
+
+struct Format {
+    LogLevel level;
+    std::string file;
+    u32 line;
+    std::string format;
+};
+
+class Reader {
+public:
+    explicit Reader(std::string_view data)
+        : m_data(data)
+    {
+    }
+
+    template <typename T>
+    bool take(T& value)
+    {
+        if (m_data.size() < sizeof(T))
+            return false;
+        std::memcpy(&value, m_data.data(), sizeof(T));
+        m_data.remove_prefix(sizeof(T));
+        return true;
+    }
+
+    template <typename Length>
+    bool takeString(std::string_view& value)
+    {
+        Length length;
+        if (!take(length) || m_data.size() < length)
+            return false;
+        value = m_data.substr(0, length);
+        m_data.remove_prefix(length);
+        return true;
+    }
+
+    bool empty() const { return m_data.empty(); }
+
+private:
+    std::string_view m_data;
+};
+
+std::string_view formatTime(u64 wallNs)
+{
+    std::chrono::system_clock::time_point time(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(wallNs)));
+    return utils::formatTimestamp(time, utils::TimePrecision::Milliseconds);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <file.blog[.gz]> [-l]" << std::endl;
+        return 1;
+    }
+    bool printFileAndLine = argc > 2 && std::string_view(argv[2]) == "-l";
+
+    // zlib reads uncompressed files as they are, rotated segments are gzipped
+    gzFile file = gzopen(argv[1], "rb");
+    if (!file) {
+        std::cerr << "Can't open '" << argv[1] << "'" << std::endl;
+        return 1;
+    }
+    std::string data;
+    char buffer[64 * 1024];
+    int count;
+    while ((count = gzread(file, buffer, sizeof(buffer))) > 0) {
+        data.append(buffer, count);
+    }
+    gzclose(file);
+
+    Reader reader(data);
+    char magic[sizeof(binlog::MAGIC)];
+    u64 wallAtOpen = 0;
+    u64 monotonicAtOpen = 0;
+    std::string_view source;
+    if (!reader.take(magic) || std::memcmp(magic, binlog::MAGIC, sizeof(magic)) != 0
+        || !reader.take(wallAtOpen) || !reader.take(monotonicAtOpen) || !reader.takeString<u16>(source)) {
+        std::cerr << "'" << argv[1] << "' is not a binary log" << std::endl;
+        return 1;
+    }
+
+    const char levels[] = { 'D', 'I', 'W', 'E', 'N' };
+    std::unordered_map<u32, Format> formats;
+
+    while (!reader.empty()) {
+        u8 kind;
+        reader.take(kind);
+
+        if (kind == binlog::RecordKind::Format) {
+            u32 id;
+            u8 level;
+            u32 line;
+            std::string_view fileName;
+            std::string_view format;
+            if (!reader.take(id) || !reader.take(level) || !reader.take(line)
+                || !reader.takeString<u16>(fileName) || !reader.takeString<u32>(format)) {
+                break;
+            }
+            formats[id] = { static_cast<LogLevel>(std::min<u8>(level, LogLevel::None)), std::string(fileName), line, std::string(format) };
+        } else if (kind == binlog::RecordKind::Event) {
+            u32 id;
+            u64 timestamp;
+            std::string_view args;
+            if (!reader.take(id) || !reader.take(timestamp) || !reader.takeString<u32>(args)) {
+                break;
+            }
+
+            auto it = formats.find(id);
+            if (it == formats.end()) {
+                std::cerr << "record references unknown format " << id << std::endl;
+                continue;
+            }
+            const Format& format = it->second;
+
+            std::cout << "[" << formatTime(wallAtOpen + (timestamp - monotonicAtOpen)) << "] [" << levels[format.level] << "] ";
+            if (printFileAndLine)
+                std::cout << format.file << ":" << format.line << ": ";
+            if (!source.empty())
+                std::cout << "[" << source << "] ";
+            std::cout << binlog::render(format.format, args) << '\n';
+        } else {
+            // zeroed tail of a log that was not closed cleanly
+            break;
+        }
+    }
+
+    if (!reader.empty()) {
+        std::cerr << "stopped at a truncated or unknown record" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "server/network/TokenValidator.hpp"
+
+/*
+ * Issues a connect token signed with the server's auth_secret.
+ *   tokenissuer <clientId> [ttl seconds] [config.json]
+ * The token goes to stdout only, it is a live credential until it expires.
+ */
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <clientId> [ttl seconds] [config.json]" << std::endl;
+        return 1;
+    }
+
+    s64 clientId = std::strtoll(argv[1], nullptr, 10);
+    s64 ttl = argc > 2 ? std::strtoll(argv[2], nullptr, 10) : 3600;
+    const char* configPath = argc > 3 ? argv[3] : "config.json";
+    if (clientId <= 0 || ttl <= 0) {
+        std::cerr << "clientId and ttl have to be positive" << std::endl;
+        return 1;
+    }
+
+    std::string secret;
+    try {
+        std::ifstream file(configPath);
+        nlohmann::json json;
+        file >> json;
+        secret = json.value("auth_secret", "");
+    } catch (const std::exception& e) {
+        std::cerr << "Can't read '" << configPath << "': " << e.what() << std::endl;
+        return 1;
+    }
+    if (secret.empty()) {
+        std::cerr << "auth_secret is not set in '" << configPath << "'" << std::endl;
+        return 1;
+    }
+
+    TokenValidator::init(std::move(secret), 0);
+    auto expiresAt = std::chrono::system_clock::now() + std::chrono::seconds(ttl);
+    std::cout << TokenValidator::issue(clientId, std::chrono::duration_cast<std::chrono::seconds>(expiresAt.time_since_epoch()).count()) << std::endl;
+    return 0;
+}
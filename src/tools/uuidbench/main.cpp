@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+#include "common/core/UUIDProvider.hpp"
+
+/*
+ * Compares handing out ids one at a time with UUIDProvider::nextUUID against
+ * blocks from UUIDProvider::reserve.
+ *   uuidbench [bursts] [block] [sustained ids]
+ * A shard only has 256 ids per millisecond, so ids are drawn in bursts that
+ * fit in its borrow window and only the bursts are timed; otherwise the
+ * numbers would show the rate limit instead of the cost per id. The
+ * sustained run then draws one large count through reserve, looping over
+ * the short ranges it returns, and reports the rate the shard keeps up.
+ */
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr u32 BURST = 1024;
+constexpr auto REFILL = std::chrono::milliseconds(8);
+
+template <typename Fn>
+double nsPerId(u32 bursts, Fn&& draw)
+{
+    Clock::duration elapsed {};
+    for (u32 i = 0; i < bursts; ++i) {
+        // untimed, lets the shard's clock fall back behind the wall clock
+        std::this_thread::sleep_for(REFILL);
+        auto start = Clock::now();
+        draw();
+        elapsed += Clock::now() - start;
+    }
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (double(bursts) * BURST);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    u32 bursts = argc > 1 ? static_cast<u32>(std::strtoul(argv[1], nullptr, 10)) : 256;
+    u32 block = argc > 2 ? static_cast<u32>(std::strtoul(argv[2], nullptr, 10)) : 256;
+    u64 sustained = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1000000;
+    if (bursts == 0 || block == 0 || block > BURST || BURST % block != 0 || sustained == 0) {
+        std::cerr << "usage: " << argv[0] << " [bursts] [block] [sustained ids], block has to divide " << BURST << std::endl;
+        return 1;
+    }
+
+    UUIDProvider::init(1, 1, 687888001020L);
+
+    // summed so neither loop can be optimized away
+    s64 sink = 0;
+    double single = nsPerId(bursts, [&sink]() {
+        for (u32 i = 0; i < BURST; ++i) {
+            sink += UUIDProvider::nextUUID();
+        }
+    });
+    double reserved = nsPerId(bursts, [&sink, block]() {
+        for (u32 i = 0; i < BURST;) {
+            auto range = UUIDProvider::reserve(block);
+            for (s64 id : range) {
+                sink += id;
+            }
+            i += static_cast<u32>(range.size());
+        }
+    });
+
+    std::this_thread::sleep_for(REFILL);
+    auto start = Clock::now();
+    for (u64 drawn = 0; drawn < sustained;) {
+        // an empty range means the shard has borrowed all it may, ask again
+        auto range = UUIDProvider::reserve(static_cast<u32>(std::min<u64>(sustained - drawn, UINT32_MAX)));
+        for (s64 id : range) {
+            sink += id;
+        }
+        drawn += range.size();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    volatile s64 keep = sink;
+    (void)keep;
+
+    std::cout << bursts * BURST << " ids per run" << std::endl;
+    std::cout << "nextUUID:        " << single << " ns/id" << std::endl;
+    std::cout << "reserve(" << block << "): " << reserved << " ns/id" << std::endl;
+    std::cout << "reserve(" << sustained << ") sustained: " << sustained / seconds << " ids/s, at most "
+              << UUIDProvider::maxReserve() << " ids per call" << std::endl;
+    return 0;
+}
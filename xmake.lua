@@ -2,25 +2,56 @@ add_rules("mode.debug", "mode.release")
 
 add_includedirs("src")
 
+option("log_min_level")
+    set_default("0")
+    set_showmenu(true)
+    set_description("Compile out log calls below this level (0 debug, 1 info, 2 warning, 3 error)")
+option_end()
+
+add_defines("LOG_MIN_LEVEL=$(log_min_level)")
+
 add_requires(
     "nlohmann_json",
     "asio",
     "protobuf-cpp",
-    "concurrentqueue"
+    "concurrentqueue",
+    "zlib",
+    "openssl"
 )
 
 target("common")
     set_kind("static")
-    add_files("src/common/**.cpp")
+    add_files("src/common/**.cpp", "src/common/**.cc")
     set_languages("c++20")
-    add_packages("nlohmann_json","asio","protobuf-cpp", "concurrentqueue")
+    add_packages("nlohmann_json","asio","protobuf-cpp", "concurrentqueue", "zlib", "openssl")
 
 target("server")
     set_kind("binary")
     add_files("src/server/**.cpp")
     set_languages("c++20")
     add_deps("common")
-    add_packages("nlohmann_json","asio","protobuf-cpp", "concurrentqueue")
+    add_packages("nlohmann_json","asio","protobuf-cpp", "concurrentqueue", "zlib", "openssl")
+
+target("logdecoder")
+    set_kind("binary")
+    add_files("src/tools/logdecoder/*.cpp")
+    set_languages("c++20")
+    add_deps("common")
+    add_packages("nlohmann_json","asio","protobuf-cpp", "concurrentqueue", "zlib", "openssl")
+
+target("uuidbench")
+    set_kind("binary")
+    add_files("src/tools/uuidbench/*.cpp")
+    set_languages("c++20")
+    add_deps("common")
+    add_packages("nlohmann_json","asio","protobuf-cpp", "concurrentqueue", "zlib", "openssl")
+
+target("tokenissuer")
+    set_kind("binary")
+    add_files("src/tools/tokenissuer/*.cpp", "src/server/network/TokenValidator.cpp")
+    set_languages("c++20")
+    add_deps("common")
+    add_packages("nlohmann_json","asio","protobuf-cpp", "concurrentqueue", "zlib", "openssl")
 
 
 